@@ -14,6 +14,7 @@ public class DolbyIO : ModuleRules
 
         PublicDependencyModuleNames.AddRange(
             new string[] { "Core", "CoreUObject", "Engine", "HTTP", "Json", "Projects", "RenderCore", "RHI" });
+        PrivateDependencyModuleNames.Add("DolbyIOShaders");
 
         string ReleaseDir = "sdk-release";
         if (Target.Platform == UnrealTargetPlatform.Linux)
@@ -0,0 +1,144 @@
+// Copyright 2023 Dolby Laboratories
+
+#include "Utils/DolbyIOCppSdk.h"
+#include "Utils/DolbyIOLLM.h"
+#include "Utils/DolbyIOLogging.h"
+#include "Utils/DolbyIOStats.h"
+#include "Utils/DolbyIOTrace.h"
+#include "Video/DolbyIOVideoUploadScheduler.h"
+
+#include "HAL/PlatformProcess.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/Paths.h"
+#include "Modules/ModuleManager.h"
+
+class FDolbyIOModule final : public IModuleInterface
+{
+	using FDllHandle = void*;
+
+public:
+	void StartupModule() override
+	{
+		const FString PluginDir = IPluginManager::Get().FindPlugin("DolbyIO")->GetBaseDir();
+		DolbyIO::FVideoUploadScheduler::Startup();
+
+		FString BaseDir = FPaths::Combine(PluginDir, TEXT("sdk-release"));
+#if PLATFORM_WINDOWS
+		using namespace dolbyio::comms;
+		app_allocator Allocator{&Allocate, &AllocateAligned, &Free, &FreeAligned};
+		BaseDir = FPaths::Combine(BaseDir, TEXT("bin"));
+		LoadDll(BaseDir, "avutil-57.dll");
+		LoadDll(BaseDir, "avcodec-59.dll");
+		LoadDll(BaseDir, "dvclient.dll");
+		LoadDll(BaseDir, "dolbyio_comms_media.dll");
+		LoadDll(BaseDir, "dolbyio_comms_sdk.dll");
+		sdk::set_app_allocator(Allocator);
+		LoadDll(BaseDir, "opencv_core451.dll");
+		LoadDll(BaseDir, "opencv_imgproc451.dll");
+		LoadDll(BaseDir, "opencv_imgcodecs451.dll");
+		LoadDll(BaseDir, "dvdnr.dll");
+		LoadDll(BaseDir, "dlb_vidseg_c_api.dll");
+		LoadDll(BaseDir, "video_processor.dll");
+		dolbyio::comms::plugin::video_processor::set_app_allocator(Allocator);
+#elif PLATFORM_MAC
+		BaseDir = FPaths::Combine(BaseDir, TEXT("lib"));
+		LoadDll(BaseDir, "libdolbyio_comms_media.dylib");
+		LoadDll(BaseDir, "libdolbyio_comms_sdk.dylib");
+		LoadDll(BaseDir, "libvideo_processor.dylib");
+#elif PLATFORM_LINUX
+		BaseDir += "-ubuntu-20.04-clang10-libc++10";
+		BaseDir = FPaths::Combine(BaseDir, TEXT("lib"));
+		LoadDll(BaseDir, "libavutil.so.57");
+		LoadDll(BaseDir, "libavcodec.so.59");
+		LoadDll(BaseDir, "libavformat.so.59");
+		LoadDll(BaseDir, "libdvclient.so");
+		LoadDll(BaseDir, "libdolbyio_comms_media.so");
+		LoadDll(BaseDir, "libdolbyio_comms_sdk.so");
+#endif
+	}
+
+	void ShutdownModule() override
+	{
+		DolbyIO::FVideoUploadScheduler::Shutdown();
+
+		while (Dlls.Num())
+		{
+			const FDll Dll = Dlls.Pop();
+			FPlatformProcess::FreeDllHandle(Dll.Handle);
+			DLB_UE_LOG("Unloaded %s", *Dll.Name);
+		}
+	}
+
+private:
+#if PLATFORM_WINDOWS
+	// The SDK allocates on its own threads, so each allocation is tagged rather than the calls into the SDK
+	static void* Allocate(std::size_t Count)
+	{
+		LLM_SCOPE_BYTAG(DolbyIO_Sdk);
+		return ::operator new(Count);
+	}
+	static void* AllocateAligned(std::size_t Count, std::size_t Al)
+	{
+		LLM_SCOPE_BYTAG(DolbyIO_Sdk);
+		return ::operator new(Count, static_cast<std::align_val_t>(Al));
+	}
+	static void Free(void* Ptr)
+	{
+		::operator delete(Ptr);
+	}
+	static void FreeAligned(void* Ptr, std::size_t Al)
+	{
+		::operator delete(Ptr, static_cast<std::align_val_t>(Al));
+	}
+#endif
+
+	void LoadDll(const FString& BaseDir, const FString& Dll)
+	{
+		const FString DllPath = FPaths::Combine(*BaseDir, *Dll);
+		if (FDllHandle Handle = FPlatformProcess::GetDllHandle(*DllPath))
+		{
+			DLB_UE_LOG("Loaded %s", *Dll);
+			Dlls.Emplace(FDll{Handle, Dll});
+		}
+		else
+		{
+			DLB_UE_LOG_BASE(Fatal, "Failed to load %s", *DllPath);
+		}
+	}
+
+	struct FDll
+	{
+		FDllHandle Handle;
+		FString Name;
+	};
+
+	TArray<FDll> Dlls;
+};
+
+IMPLEMENT_MODULE(FDolbyIOModule, DolbyIO)
+DEFINE_LOG_CATEGORY(LogDolbyIO);
+
+UE_TRACE_CHANNEL_DEFINE(DolbyIOChannel);
+
+DECLARE_LLM_MEMORY_STAT(TEXT("DolbyIO"), STAT_DolbyIOLLM, STATGROUP_LLMFULL);
+DECLARE_LLM_MEMORY_STAT(TEXT("DolbyIO"), STAT_DolbyIOSummaryLLM, STATGROUP_LLM);
+LLM_DEFINE_TAG(DolbyIO, NAME_None, NAME_None, GET_STATFNAME(STAT_DolbyIOLLM), GET_STATFNAME(STAT_DolbyIOSummaryLLM));
+LLM_DEFINE_TAG(DolbyIO_Sdk, NAME_None, NAME_None, NAME_None, GET_STATFNAME(STAT_DolbyIOSummaryLLM));
+LLM_DEFINE_TAG(DolbyIO_Video, NAME_None, NAME_None, NAME_None, GET_STATFNAME(STAT_DolbyIOSummaryLLM));
+LLM_DEFINE_TAG(DolbyIO_Participants, NAME_None, NAME_None, NAME_None, GET_STATFNAME(STAT_DolbyIOSummaryLLM));
+LLM_DEFINE_TAG(DolbyIO_Events, NAME_None, NAME_None, NAME_None, GET_STATFNAME(STAT_DolbyIOSummaryLLM));
+
+TRACE_DECLARE_INT_COUNTER(DolbyIOActiveSinks, TEXT("DolbyIO/Active Sinks"));
+TRACE_DECLARE_INT_COUNTER(DolbyIOFramesInFlight, TEXT("DolbyIO/Frames In Flight"));
+TRACE_DECLARE_INT_COUNTER(DolbyIOBytesUploaded, TEXT("DolbyIO/Bytes Uploaded"));
+
+DEFINE_STAT(STAT_DolbyIO_HandleEvent);
+DEFINE_STAT(STAT_DolbyIO_BroadcastEvent);
+DEFINE_STAT(STAT_DolbyIO_ConvertFrame);
+DEFINE_STAT(STAT_DolbyIO_UploadFrame);
+DEFINE_STAT(STAT_DolbyIO_SpatialUpdate);
+DEFINE_STAT(STAT_DolbyIO_SuppressedListenerUpdates);
+DEFINE_STAT(STAT_DolbyIO_VideoBufferMemory);
+DEFINE_STAT(STAT_DolbyIO_VideoTextureMemory);
+std::atomic<int64> DolbyIO::VideoBufferMemory{0};
+std::atomic<int64> DolbyIO::VideoTextureMemory{0};
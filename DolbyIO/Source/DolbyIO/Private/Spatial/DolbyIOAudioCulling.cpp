@@ -0,0 +1,158 @@
+// Copyright 2023 Dolby Laboratories
+
+#include "DolbyIOAudioCulling.h"
+
+#include "DolbyIO.h"
+#include "Utils/DolbyIOConversions.h"
+#include "Utils/DolbyIOErrorHandler.h"
+#include "Utils/DolbyIOLogging.h"
+#include "Utils/DolbyIOStats.h"
+
+namespace DolbyIO
+{
+	FAudioCulling::FAudioCulling(UDolbyIOSubsystem& Subsystem) : Subsystem(Subsystem)
+	{
+	}
+
+	void FAudioCulling::SetDistance(float InDistance, float InHysteresis)
+	{
+		Distance = FMath::Max(InDistance, 0.0f);
+		// A hysteresis as large as the distance would never start the audio of culled participants again
+		Hysteresis = FMath::Clamp(InHysteresis, 0.0f, Distance * MaxHysteresisRatio);
+		if (Distance && Hysteresis != InHysteresis)
+		{
+			DLB_UE_LOG_BASE(Warning, "Clamping culling hysteresis %f to %f for culling distance %f", InHysteresis,
+			                Hysteresis, Distance);
+		}
+		bIsDirty = true;
+	}
+
+	void FAudioCulling::MarkDirty()
+	{
+		bIsDirty = true;
+	}
+
+	void FAudioCulling::SetListenerLocation(const FVector& Location)
+	{
+		ListenerLocation = Location;
+		bIsDirty = true;
+	}
+
+	void FAudioCulling::SetParticipantLocation(const FString& ParticipantID, const FVector& Location)
+	{
+		ParticipantLocations.Add(ParticipantID, Location);
+		bIsDirty = true;
+	}
+
+	void FAudioCulling::SetParticipantMuted(const FString& ParticipantID, bool bIsMuted)
+	{
+		if (bIsMuted)
+		{
+			MutedParticipants.Add(ParticipantID);
+		}
+		else
+		{
+			MutedParticipants.Remove(ParticipantID);
+		}
+	}
+
+	bool FAudioCulling::IsCulled(const FString& ParticipantID) const
+	{
+		return CulledParticipants.Contains(ParticipantID);
+	}
+
+	void FAudioCulling::Update()
+	{
+		// The audio of all participants is received again in the next conference
+		if (!Subsystem.IsConnectedAsActive() || Subsystem.SpatialAudioStyle != EDolbyIOSpatialAudioStyle::Individual)
+		{
+			Reset();
+			return;
+		}
+		if (!bIsDirty.exchange(false))
+		{
+			return;
+		}
+
+		SCOPE_CYCLE_COUNTER(STAT_DolbyIO_SpatialUpdate);
+
+		if (!Distance || !ListenerLocation)
+		{
+			for (const FString& ParticipantID : CulledParticipants.Array())
+			{
+				Uncull(ParticipantID);
+			}
+			return;
+		}
+
+		const float CullDistanceSquared = FMath::Square(Distance);
+		const float UncullDistanceSquared = FMath::Square(Distance - Hysteresis);
+		TArray<FString> ToCull;
+		TArray<FString> ToUncull;
+		{
+			FScopeLock Lock{&Subsystem.RemoteParticipantsLock};
+			for (auto It = ParticipantLocations.CreateIterator(); It; ++It)
+			{
+				const FDolbyIOParticipantInfo* Info = Subsystem.RemoteParticipants.Find(It.Key());
+				if (!Info)
+				{
+					CulledParticipants.Remove(It.Key());
+					It.RemoveCurrent();
+					continue;
+				}
+				// The audio of participants who rejoin is received again, their location is kept to check them then
+				if (Info->Status != EDolbyIOParticipantStatus::OnAir)
+				{
+					CulledParticipants.Remove(It.Key());
+					continue;
+				}
+
+				const float DistanceSquared = FVector::DistSquared(*ListenerLocation, It.Value());
+				const bool bIsCulled = CulledParticipants.Contains(It.Key());
+				if (!bIsCulled && DistanceSquared > CullDistanceSquared)
+				{
+					ToCull.Add(It.Key());
+				}
+				else if (bIsCulled && DistanceSquared < UncullDistanceSquared)
+				{
+					ToUncull.Add(It.Key());
+				}
+			}
+		}
+		for (const FString& ParticipantID : ToCull)
+		{
+			Cull(ParticipantID);
+		}
+		for (const FString& ParticipantID : ToUncull)
+		{
+			Uncull(ParticipantID);
+		}
+	}
+
+	void FAudioCulling::Cull(const FString& ParticipantID)
+	{
+		CulledParticipants.Add(ParticipantID);
+		if (!MutedParticipants.Contains(ParticipantID))
+		{
+			DLB_UE_LOG_BASE(Verbose, "Stopping audio of participant ID %s beyond culling distance", *ParticipantID);
+			Subsystem.Sdk->audio().remote().stop(ToStdString(ParticipantID)).on_error(DLB_ERROR_HANDLER_NO_DELEGATE);
+		}
+	}
+
+	void FAudioCulling::Uncull(const FString& ParticipantID)
+	{
+		CulledParticipants.Remove(ParticipantID);
+		if (!MutedParticipants.Contains(ParticipantID))
+		{
+			DLB_UE_LOG_BASE(Verbose, "Starting audio of participant ID %s within culling distance", *ParticipantID);
+			Subsystem.Sdk->audio().remote().start(ToStdString(ParticipantID)).on_error(DLB_ERROR_HANDLER_NO_DELEGATE);
+		}
+	}
+
+	void FAudioCulling::Reset()
+	{
+		ParticipantLocations.Reset();
+		CulledParticipants.Reset();
+		MutedParticipants.Reset();
+	}
+}
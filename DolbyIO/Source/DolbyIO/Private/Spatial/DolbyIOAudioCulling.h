@@ -0,0 +1,61 @@
+// Copyright 2023 Dolby Laboratories
+
+#pragma once
+
+#include "Containers/Map.h"
+#include "Containers/Set.h"
+#include "Containers/UnrealString.h"
+#include "Math/Vector.h"
+#include "Misc/Optional.h"
+
+#include <atomic>
+
+class UDolbyIOSubsystem;
+
+namespace DolbyIO
+{
+	/** Stops receiving the audio of remote participants who are farther from the listener than the culling distance
+	 * and starts it again once they come back within the distance minus the hysteresis, so that participants moving
+	 * along the edge are not stopped and started repeatedly. Uses the locations sent for spatial audio purposes, so it
+	 * only applies to participants whose locations are set, and is only accessed on the game thread unless noted. */
+	class FAudioCulling final
+	{
+	public:
+		FAudioCulling(UDolbyIOSubsystem& Subsystem);
+
+		/** A distance of 0 disables culling and starts the audio of all culled participants again. */
+		void SetDistance(float Distance, float Hysteresis);
+		void SetListenerLocation(const FVector& Location);
+		void SetParticipantLocation(const FString& ParticipantID, const FVector& Location);
+		// May be called on any thread, checks all participants in the next update
+		void MarkDirty();
+
+		/** Participants muted with Mute Participant are neither stopped nor started by culling. */
+		void SetParticipantMuted(const FString& ParticipantID, bool bIsMuted);
+		bool IsCulled(const FString& ParticipantID) const;
+
+		// Called once per frame
+		void Update();
+
+		UDolbyIOSubsystem& GetSubsystem()
+		{
+			return Subsystem;
+		}
+
+	private:
+		void Cull(const FString& ParticipantID);
+		void Uncull(const FString& ParticipantID);
+		void Reset();
+
+		UDolbyIOSubsystem& Subsystem;
+		float Distance = 0.0f;
+		float Hysteresis = 0.0f;
+		TOptional<FVector> ListenerLocation;
+		TMap<FString, FVector> ParticipantLocations;
+		TSet<FString> CulledParticipants;
+		TSet<FString> MutedParticipants;
+		std::atomic<bool> bIsDirty{false};
+
+		static constexpr float MaxHysteresisRatio = 0.5f;
+	};
+}
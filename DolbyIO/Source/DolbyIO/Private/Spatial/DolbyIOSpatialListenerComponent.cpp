@@ -0,0 +1,106 @@
+// Copyright 2023 Dolby Laboratories
+
+#include "DolbyIOSpatialListenerComponent.h"
+
+#include "DolbyIO.h"
+#include "DolbyIOBlueprints.h"
+
+UDolbyIOSpatialListenerComponent::UDolbyIOSpatialListenerComponent()
+{
+	bAutoActivate = true;
+	bWantsOnUpdateTransform = true;
+}
+
+void UDolbyIOSpatialListenerComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (UDolbyIOSubsystem* DolbyIOSubsystem = GetDolbyIOSubsystem(this))
+	{
+		DolbyIOSubsystem->OnConnected.AddDynamic(this, &UDolbyIOSpatialListenerComponent::OnConnected);
+	}
+	if (IsActive())
+	{
+		AddListener();
+	}
+}
+
+void UDolbyIOSpatialListenerComponent::EndPlay(EEndPlayReason::Type EndPlayReason)
+{
+	RemoveListener();
+	if (UDolbyIOSubsystem* DolbyIOSubsystem = GetDolbyIOSubsystem(this))
+	{
+		DolbyIOSubsystem->OnConnected.RemoveDynamic(this, &UDolbyIOSpatialListenerComponent::OnConnected);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UDolbyIOSpatialListenerComponent::Activate(bool bReset)
+{
+	Super::Activate(bReset);
+
+	// Components activated automatically are added once play begins
+	if (HasBegunPlay() && IsActive())
+	{
+		AddListener();
+	}
+}
+
+void UDolbyIOSpatialListenerComponent::Deactivate()
+{
+	Super::Deactivate();
+	RemoveListener();
+}
+
+void UDolbyIOSpatialListenerComponent::OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags,
+                                                         ETeleportType Teleport)
+{
+	Super::OnUpdateTransform(UpdateTransformFlags, Teleport);
+
+	if (bIsListener)
+	{
+		if (UDolbyIOSubsystem* DolbyIOSubsystem = GetDolbyIOSubsystem(this))
+		{
+			DolbyIOSubsystem->SetListenerTransform(*this, GetComponentTransform());
+		}
+	}
+}
+
+void UDolbyIOSpatialListenerComponent::OnConnected(const FString& LocalParticipantID, const FString& ConferenceID)
+{
+	// The conference does not know the listener's transform yet even if the component has not moved
+	if (bIsListener)
+	{
+		if (UDolbyIOSubsystem* DolbyIOSubsystem = GetDolbyIOSubsystem(this))
+		{
+			DolbyIOSubsystem->SetListenerTransform(*this, GetComponentTransform(), true);
+		}
+	}
+}
+
+void UDolbyIOSpatialListenerComponent::AddListener()
+{
+	if (bIsListener)
+	{
+		return;
+	}
+	if (UDolbyIOSubsystem* DolbyIOSubsystem = GetDolbyIOSubsystem(this))
+	{
+		bIsListener = true;
+		DolbyIOSubsystem->AddListenerComponent(*this);
+	}
+}
+
+void UDolbyIOSpatialListenerComponent::RemoveListener()
+{
+	if (!bIsListener)
+	{
+		return;
+	}
+	bIsListener = false;
+	if (UDolbyIOSubsystem* DolbyIOSubsystem = GetDolbyIOSubsystem(this))
+	{
+		DolbyIOSubsystem->RemoveListenerComponent(*this);
+	}
+}
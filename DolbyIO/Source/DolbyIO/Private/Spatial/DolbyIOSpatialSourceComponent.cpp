@@ -0,0 +1,77 @@
+// Copyright 2023 Dolby Laboratories
+
+#include "DolbyIOSpatialSourceComponent.h"
+
+#include "DolbyIO.h"
+#include "DolbyIOBlueprints.h"
+#include "DolbyIOSpatialSources.h"
+
+UDolbyIOSpatialSourceComponent::UDolbyIOSpatialSourceComponent()
+{
+	bAutoActivate = true;
+}
+
+void UDolbyIOSpatialSourceComponent::SetParticipantID(const FString& InParticipantID)
+{
+	ParticipantID = InParticipantID;
+}
+
+void UDolbyIOSpatialSourceComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (IsActive())
+	{
+		AddSource();
+	}
+}
+
+void UDolbyIOSpatialSourceComponent::EndPlay(EEndPlayReason::Type EndPlayReason)
+{
+	RemoveSource();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UDolbyIOSpatialSourceComponent::Activate(bool bReset)
+{
+	Super::Activate(bReset);
+
+	// Sources are only sent to the subsystem while playing, BeginPlay adds those activated before
+	if (HasBegunPlay() && IsActive())
+	{
+		AddSource();
+	}
+}
+
+void UDolbyIOSpatialSourceComponent::Deactivate()
+{
+	Super::Deactivate();
+	RemoveSource();
+}
+
+void UDolbyIOSpatialSourceComponent::AddSource()
+{
+	if (bIsSource)
+	{
+		return;
+	}
+	if (UDolbyIOSubsystem* DolbyIOSubsystem = GetDolbyIOSubsystem(this))
+	{
+		bIsSource = true;
+		DolbyIOSubsystem->SpatialSources->Add(*this);
+	}
+}
+
+void UDolbyIOSpatialSourceComponent::RemoveSource()
+{
+	if (!bIsSource)
+	{
+		return;
+	}
+	bIsSource = false;
+	if (UDolbyIOSubsystem* DolbyIOSubsystem = GetDolbyIOSubsystem(this))
+	{
+		DolbyIOSubsystem->SpatialSources->Remove(*this);
+	}
+}
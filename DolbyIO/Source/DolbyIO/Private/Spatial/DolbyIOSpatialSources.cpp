@@ -0,0 +1,79 @@
+// Copyright 2023 Dolby Laboratories
+
+#include "DolbyIOSpatialSources.h"
+
+#include "DolbyIO.h"
+#include "DolbyIOSpatialSourceComponent.h"
+#include "Utils/DolbyIOStats.h"
+
+#include "HAL/IConsoleManager.h"
+
+namespace DolbyIO
+{
+	namespace
+	{
+		TAutoConsoleVariable<float> CVarSpatialSourceThreshold(
+		    TEXT("DolbyIO.SpatialSourceThreshold"), 1.0f,
+		    TEXT("Distance in units a spatial source must move before its new location is sent."));
+	}
+
+	void FSpatialSources::Add(UDolbyIOSpatialSourceComponent& Component)
+	{
+		Sources.Add(FSource{&Component});
+	}
+
+	void FSpatialSources::Remove(UDolbyIOSpatialSourceComponent& Component)
+	{
+		Sources.RemoveAllSwap([&Component](const FSource& Source)
+		                      { return !Source.Component.IsValid() || Source.Component.Get() == &Component; });
+	}
+
+	void FSpatialSources::Collect(UDolbyIOSubsystem& Subsystem)
+	{
+		if (!Sources.Num())
+		{
+			return;
+		}
+
+		SCOPE_CYCLE_COUNTER(STAT_DolbyIO_SpatialUpdate);
+
+		if (!Subsystem.IsConnectedAsActive() || Subsystem.SpatialAudioStyle != EDolbyIOSpatialAudioStyle::Individual)
+		{
+			for (FSource& Source : Sources)
+			{
+				Source.LastLocation.Reset();
+			}
+			return;
+		}
+
+		const float ThresholdSquared = FMath::Square(CVarSpatialSourceThreshold.GetValueOnGameThread());
+		FScopeLock Lock{&Subsystem.RemoteParticipantsLock};
+		for (FSource& Source : Sources)
+		{
+			const UDolbyIOSpatialSourceComponent* Component = Source.Component.Get();
+			if (!Component)
+			{
+				continue;
+			}
+
+			// Locations of participants who are not in the conference are sent again once they are
+			const FString& ParticipantID = Component->ParticipantID;
+			const FDolbyIOParticipantInfo* Info = Subsystem.RemoteParticipants.Find(ParticipantID);
+			if (!Info || Info->Status != EDolbyIOParticipantStatus::OnAir)
+			{
+				Source.LastLocation.Reset();
+				continue;
+			}
+
+			const FVector Location = Component->GetComponentLocation();
+			if (Source.LastLocation && Source.LastParticipantID == ParticipantID &&
+			    FVector::DistSquared(Location, *Source.LastLocation) < ThresholdSquared)
+			{
+				continue;
+			}
+			Source.LastParticipantID = ParticipantID;
+			Source.LastLocation = Location;
+			Subsystem.PendingRemotePlayerLocations.Add(ParticipantID, Location);
+		}
+	}
+}
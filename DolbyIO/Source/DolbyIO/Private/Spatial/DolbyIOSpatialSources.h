@@ -0,0 +1,38 @@
+// Copyright 2023 Dolby Laboratories
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/UnrealString.h"
+#include "Math/Vector.h"
+#include "Misc/Optional.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UDolbyIOSpatialSourceComponent;
+class UDolbyIOSubsystem;
+
+namespace DolbyIO
+{
+	/** Keeps track of the active spatial source components and gathers their locations on the game thread once per
+	 * frame, in a single pass instead of one Blueprint call per source. */
+	class FSpatialSources final
+	{
+	public:
+		void Add(UDolbyIOSpatialSourceComponent& Component);
+		void Remove(UDolbyIOSpatialSourceComponent& Component);
+
+		/** Adds the locations of the sources which moved since they were last sent to the subsystem's pending remote
+		 * player locations. */
+		void Collect(UDolbyIOSubsystem& Subsystem);
+
+	private:
+		struct FSource
+		{
+			TWeakObjectPtr<UDolbyIOSpatialSourceComponent> Component;
+			FString LastParticipantID;
+			TOptional<FVector> LastLocation;
+		};
+
+		TArray<FSource> Sources;
+	};
+}
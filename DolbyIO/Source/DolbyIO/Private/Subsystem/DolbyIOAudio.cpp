@@ -2,14 +2,29 @@
 
 #include "DolbyIO.h"
 
+#include "Spatial/DolbyIOAudioCulling.h"
 #include "Utils/DolbyIOBroadcastEvent.h"
 #include "Utils/DolbyIOConversions.h"
 #include "Utils/DolbyIOErrorHandler.h"
 #include "Utils/DolbyIOLogging.h"
 
+#include "HAL/IConsoleManager.h"
+
 using namespace dolbyio::comms;
 using namespace DolbyIO;
 
+namespace
+{
+	TAutoConsoleVariable<float> CVarActiveSpeakersInterval(
+	    TEXT("DolbyIO.ActiveSpeakersInterval"), 0.0f,
+	    TEXT("Minimum number of seconds between two OnActiveSpeakersChanged events, only the latest active speakers ")
+	    TEXT("are broadcast. 0 = at most once per frame (default)."));
+	TAutoConsoleVariable<float> CVarAudioLevelsInterval(
+	    TEXT("DolbyIO.AudioLevelsInterval"), 0.0f,
+	    TEXT("Minimum number of seconds between two OnAudioLevelsChanged events, only the latest audio levels are ")
+	    TEXT("broadcast. 0 = at most once per frame (default)."));
+}
+
 void UDolbyIOSubsystem::SetSpatialEnvironment()
 {
 	if (!IsConnectedAsActive() || !IsSpatialAudio())
@@ -91,6 +106,7 @@ void UDolbyIOSubsystem::MuteParticipant(const FString& ParticipantID)
 		return;
 	}
 
+	AudioCulling->SetParticipantMuted(ParticipantID, true);
 	DLB_UE_LOG("Muting participant ID %s", *ParticipantID);
 	Sdk->audio().remote().stop(ToStdString(ParticipantID)).on_error(DLB_ERROR_HANDLER(OnMuteParticipantError));
 }
@@ -102,6 +118,13 @@ void UDolbyIOSubsystem::UnmuteParticipant(const FString& ParticipantID)
 		return;
 	}
 
+	AudioCulling->SetParticipantMuted(ParticipantID, false);
+	if (AudioCulling->IsCulled(ParticipantID))
+	{
+		DLB_UE_LOG("Participant ID %s will be unmuted when within the audio culling distance", *ParticipantID);
+		return;
+	}
+
 	DLB_UE_LOG("Unmuting participant ID %s", *ParticipantID);
 	Sdk->audio().remote().start(ToStdString(ParticipantID)).on_error(DLB_ERROR_HANDLER(OnUnmuteParticipantError));
 }
@@ -134,7 +157,8 @@ void UDolbyIOSubsystem::Handle(const active_speaker_changed& Event)
 	{
 		ActiveSpeakers.Add(ToFString(Speaker));
 	}
-	BroadcastEvent(OnActiveSpeakersChanged, ActiveSpeakers);
+	BroadcastCoalescedEvent(*this, {}, CVarActiveSpeakersInterval.GetValueOnAnyThread(), OnActiveSpeakersChanged,
+	                        ActiveSpeakers);
 }
 
 void UDolbyIOSubsystem::Handle(const audio_levels& Event)
@@ -146,5 +170,6 @@ void UDolbyIOSubsystem::Handle(const audio_levels& Event)
 		ActiveSpeakers.Add(ToFString(Level.participant_id));
 		AudioLevels.Add(Level.level);
 	}
-	BroadcastEvent(OnAudioLevelsChanged, ActiveSpeakers, AudioLevels);
+	BroadcastCoalescedEvent(*this, {}, CVarAudioLevelsInterval.GetValueOnAnyThread(), OnAudioLevelsChanged,
+	                        ActiveSpeakers, AudioLevels);
 }
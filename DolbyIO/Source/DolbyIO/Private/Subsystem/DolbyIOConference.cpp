@@ -2,14 +2,28 @@
 
 #include "DolbyIO.h"
 
+#include "Spatial/DolbyIOAudioCulling.h"
 #include "Utils/DolbyIOBroadcastEvent.h"
 #include "Utils/DolbyIOConversions.h"
 #include "Utils/DolbyIOErrorHandler.h"
+#include "Utils/DolbyIOLLM.h"
 #include "Utils/DolbyIOLogging.h"
+#include "Utils/DolbyIOTrace.h"
+
+#include "HAL/IConsoleManager.h"
 
 using namespace dolbyio::comms;
 using namespace DolbyIO;
 
+namespace
+{
+	TAutoConsoleVariable<float> CVarParticipantUpdatedInterval(
+	    TEXT("DolbyIO.ParticipantUpdatedInterval"), 0.0f,
+	    TEXT("Minimum number of seconds between two OnParticipantUpdated events for the same participant, only the ")
+	    TEXT("latest participant info is broadcast. Updates which change the status are never delayed. ")
+	    TEXT("0 = at most once per frame (default)."));
+}
+
 void UDolbyIOSubsystem::Connect(const FString& ConferenceName, const FString& UserName, const FString& ExternalID,
                                 const FString& AvatarURL, EDolbyIOConnectionMode ConnMode,
                                 EDolbyIOSpatialAudioStyle SpatialStyle, int MaxVideoStreams,
@@ -137,17 +151,18 @@ void UDolbyIOSubsystem::UpdateStatus(conference_status Status)
 {
 	ConferenceStatus = Status;
 	DLB_UE_LOG("Conference status: %s", *ToString(ConferenceStatus));
+	TRACE_BOOKMARK(TEXT("DolbyIO conference %s"), *ToString(ConferenceStatus));
 
 	switch (ConferenceStatus)
 	{
 		case conference_status::joined:
-			BroadcastEvent(OnConnected, LocalParticipantID, ConferenceID);
+			BroadcastEvent(*this, OnConnected, LocalParticipantID, ConferenceID);
 			break;
 		case conference_status::left:
 		case conference_status::error:
 			Sdk->session()
 			    .close()
-			    .then([this] { BroadcastEvent(OnDisconnected); })
+			    .then([this] { BroadcastEvent(*this, OnDisconnected); })
 			    .on_error(DLB_ERROR_HANDLER(OnDisconnectError));
 			break;
 	}
@@ -240,11 +255,14 @@ void UDolbyIOSubsystem::Handle(const remote_participant_added& Event)
 	DLB_UE_LOG("Participant status added: UserID=%s Name=%s ExternalID=%s Status=%s", *Info.UserID, *Info.Name,
 	           *Info.ExternalID, *ToString(*Event.participant.status));
 	{
+		LLM_SCOPE_BYTAG(DolbyIO_Participants);
 		FScopeLock Lock{&RemoteParticipantsLock};
 		RemoteParticipants.Emplace(Info.UserID, Info);
 	}
+	AudioCulling->MarkDirty();
 
-	BroadcastEvent(OnParticipantAdded, Info.Status, Info);
+	DiscardCoalescedEvent(*this, Info.UserID, OnParticipantUpdated);
+	BroadcastEvent(*this, OnParticipantAdded, Info.Status, Info);
 	BroadcastRemoteParticipantConnectedIfNecessary(Info);
 	ProcessBufferedVideoTracks(Info.UserID);
 }
@@ -259,12 +277,27 @@ void UDolbyIOSubsystem::Handle(const remote_participant_updated& Event)
 	const FDolbyIOParticipantInfo Info = ToFDolbyIOParticipantInfo(Event.participant);
 	DLB_UE_LOG("Participant status updated: UserID=%s Name=%s ExternalID=%s Status=%s", *Info.UserID, *Info.Name,
 	           *Info.ExternalID, *ToString(*Event.participant.status));
+	bool bStatusChanged;
 	{
+		LLM_SCOPE_BYTAG(DolbyIO_Participants);
 		FScopeLock Lock{&RemoteParticipantsLock};
-		RemoteParticipants.FindOrAdd(Info.UserID) = Info;
+		const FDolbyIOParticipantInfo* Previous = RemoteParticipants.Find(Info.UserID);
+		bStatusChanged = !Previous || Previous->Status != Info.Status;
+		RemoteParticipants.Add(Info.UserID, Info);
+	}
+	if (bStatusChanged)
+	{
+		AudioCulling->MarkDirty();
+		// Status changes must stay ordered with the connected and disconnected events, the update they supersede is
+		// dropped so that it is not broadcast after them
+		DiscardCoalescedEvent(*this, Info.UserID, OnParticipantUpdated);
+		BroadcastEvent(*this, OnParticipantUpdated, Info.Status, Info);
+	}
+	else
+	{
+		BroadcastCoalescedEvent(*this, Info.UserID, CVarParticipantUpdatedInterval.GetValueOnAnyThread(),
+		                        OnParticipantUpdated, Info.Status, Info);
 	}
-
-	BroadcastEvent(OnParticipantUpdated, Info.Status, Info);
 	BroadcastRemoteParticipantConnectedIfNecessary(Info);
 	BroadcastRemoteParticipantDisconnectedIfNecessary(Info);
 }
@@ -273,7 +306,7 @@ void UDolbyIOSubsystem::BroadcastRemoteParticipantConnectedIfNecessary(const FDo
 {
 	if (ParticipantInfo.Status == EDolbyIOParticipantStatus::OnAir)
 	{
-		BroadcastEvent(OnRemoteParticipantConnected, ParticipantInfo);
+		BroadcastEvent(*this, OnRemoteParticipantConnected, ParticipantInfo);
 	}
 }
 
@@ -283,7 +316,7 @@ void UDolbyIOSubsystem::BroadcastRemoteParticipantDisconnectedIfNecessary(
 	if (ParticipantInfo.Status == EDolbyIOParticipantStatus::Left ||
 	    ParticipantInfo.Status == EDolbyIOParticipantStatus::Kicked)
 	{
-		BroadcastEvent(OnRemoteParticipantDisconnected, ParticipantInfo);
+		BroadcastEvent(*this, OnRemoteParticipantDisconnected, ParticipantInfo);
 	}
 }
 
@@ -298,7 +331,7 @@ void UDolbyIOSubsystem::Handle(const local_participant_updated& Event)
 	DLB_UE_LOG("Local participant status updated: UserID=%s Name=%s ExternalID=%s Status=%s", *Info.UserID, *Info.Name,
 	           *Info.ExternalID, *ToString(*Event.participant.status));
 
-	BroadcastEvent(OnLocalParticipantUpdated, Info.Status, Info);
+	BroadcastEvent(*this, OnLocalParticipantUpdated, Info.Status, Info);
 }
 
 void UDolbyIOSubsystem::Handle(const conference_message_received& Event)
@@ -308,11 +341,11 @@ void UDolbyIOSubsystem::Handle(const conference_message_received& Event)
 	if (const FDolbyIOParticipantInfo* Sender = RemoteParticipants.Find(ToFString(Event.user_id)))
 	{
 		DLB_UE_LOG("Message received: \"%s\" from %s (%s)", *Message, *Sender->Name, *Sender->UserID);
-		BroadcastEvent(OnMessageReceived, Message, *Sender);
+		BroadcastEvent(*this, OnMessageReceived, Message, *Sender);
 	}
 	else
 	{
 		DLB_UE_LOG("Message received: %s from unknown participant", *Message);
-		BroadcastEvent(OnMessageReceived, Message, FDolbyIOParticipantInfo{});
+		BroadcastEvent(*this, OnMessageReceived, Message, FDolbyIOParticipantInfo{});
 	}
 }
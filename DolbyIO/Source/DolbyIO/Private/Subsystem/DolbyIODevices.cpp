@@ -77,7 +77,7 @@ namespace DolbyIO
 					        Devices.Add(ToFDolbyIOAudioDevice(Device));
 				        }
 			        }
-			        BroadcastEvent(Subsystem.OnAudioInputDevicesReceived, Devices);
+			        BroadcastEvent(Subsystem, Subsystem.OnAudioInputDevicesReceived, Devices);
 		        })
 		    .on_error(DLB_ERROR_HANDLER(Subsystem.OnGetAudioInputDevicesError));
 	}
@@ -98,7 +98,7 @@ namespace DolbyIO
 					        Devices.Add(ToFDolbyIOAudioDevice(Device));
 				        }
 			        }
-			        BroadcastEvent(Subsystem.OnAudioOutputDevicesReceived, Devices);
+			        BroadcastEvent(Subsystem, Subsystem.OnAudioOutputDevicesReceived, Devices);
 		        })
 		    .on_error(DLB_ERROR_HANDLER(Subsystem.OnGetAudioOutputDevicesError));
 	}
@@ -113,12 +113,12 @@ namespace DolbyIO
 			        if (!Device)
 			        {
 				        DLB_UE_LOG("Got current audio input device - none");
-				        BroadcastEvent(Subsystem.OnCurrentAudioInputDeviceReceived, bIsDeviceNone,
+				        BroadcastEvent(Subsystem, Subsystem.OnCurrentAudioInputDeviceReceived, bIsDeviceNone,
 				                       FDolbyIOAudioDevice{});
 				        return;
 			        }
 			        DLB_UE_LOG("Got current audio input device - %s", *ToString(*Device));
-			        BroadcastEvent(Subsystem.OnCurrentAudioInputDeviceReceived, !bIsDeviceNone,
+			        BroadcastEvent(Subsystem, Subsystem.OnCurrentAudioInputDeviceReceived, !bIsDeviceNone,
 			                       ToFDolbyIOAudioDevice(*Device));
 		        })
 		    .on_error(DLB_ERROR_HANDLER(Subsystem.OnGetCurrentAudioInputDeviceError));
@@ -134,12 +134,12 @@ namespace DolbyIO
 			        if (!Device)
 			        {
 				        DLB_UE_LOG("Got current audio output device - none");
-				        BroadcastEvent(Subsystem.OnCurrentAudioOutputDeviceReceived, bIsDeviceNone,
+				        BroadcastEvent(Subsystem, Subsystem.OnCurrentAudioOutputDeviceReceived, bIsDeviceNone,
 				                       FDolbyIOAudioDevice{});
 				        return;
 			        }
 			        DLB_UE_LOG("Got current audio output device - %s", *ToString(*Device));
-			        BroadcastEvent(Subsystem.OnCurrentAudioOutputDeviceReceived, !bIsDeviceNone,
+			        BroadcastEvent(Subsystem, Subsystem.OnCurrentAudioOutputDeviceReceived, !bIsDeviceNone,
 			                       ToFDolbyIOAudioDevice(*Device));
 		        })
 		    .on_error(DLB_ERROR_HANDLER(Subsystem.OnGetCurrentAudioOutputDeviceError));
@@ -198,7 +198,7 @@ namespace DolbyIO
 				                   *ToFString(Device.unique_id));
 				        Devices.Add(ToFDolbyIOVideoDevice(Device));
 			        }
-			        BroadcastEvent(Subsystem.OnVideoDevicesReceived, Devices);
+			        BroadcastEvent(Subsystem, Subsystem.OnVideoDevicesReceived, Devices);
 		        })
 		    .on_error(DLB_ERROR_HANDLER(Subsystem.OnGetVideoDevicesError));
 	}
@@ -213,11 +213,12 @@ namespace DolbyIO
 			        if (!Device)
 			        {
 				        DLB_UE_LOG("Got current video device - none");
-				        BroadcastEvent(Subsystem.OnCurrentVideoDeviceReceived, bIsDeviceNone, FDolbyIOVideoDevice{});
+				        BroadcastEvent(Subsystem, Subsystem.OnCurrentVideoDeviceReceived, bIsDeviceNone,
+				                       FDolbyIOVideoDevice{});
 				        return;
 			        }
 			        DLB_UE_LOG("Got current video device - %s", *ToString(*Device));
-			        BroadcastEvent(Subsystem.OnCurrentVideoDeviceReceived, !bIsDeviceNone,
+			        BroadcastEvent(Subsystem, Subsystem.OnCurrentVideoDeviceReceived, !bIsDeviceNone,
 			                       ToFDolbyIOVideoDevice(*Device));
 		        })
 		    .on_error(DLB_ERROR_HANDLER(Subsystem.OnGetCurrentVideoDeviceError));
@@ -232,9 +233,9 @@ void UDolbyIOSubsystem::Handle(const audio_device_changed& Event)
 	{
 		DLB_UE_LOG("Audio device changed for direction: %s to no device", *ToString(Event.utilized_direction));
 		if (Event.utilized_direction == audio_device::direction::input)
-			BroadcastEvent(OnCurrentAudioInputDeviceChanged, bIsDeviceNone, FDolbyIOAudioDevice{});
+			BroadcastEvent(*this, OnCurrentAudioInputDeviceChanged, bIsDeviceNone, FDolbyIOAudioDevice{});
 		else
-			BroadcastEvent(OnCurrentAudioOutputDeviceChanged, bIsDeviceNone, FDolbyIOAudioDevice{});
+			BroadcastEvent(*this, OnCurrentAudioOutputDeviceChanged, bIsDeviceNone, FDolbyIOAudioDevice{});
 		return;
 	}
 	Sdk->device_management()
@@ -248,10 +249,10 @@ void UDolbyIOSubsystem::Handle(const audio_device_changed& Event)
 				        DLB_UE_LOG("Audio device changed for direction: %s to device - %s",
 				                   *ToString(Event.utilized_direction), *ToString(Device));
 				        if (Event.utilized_direction == audio_device::direction::input)
-					        BroadcastEvent(OnCurrentAudioInputDeviceChanged, !bIsDeviceNone,
+					        BroadcastEvent(*this, OnCurrentAudioInputDeviceChanged, !bIsDeviceNone,
 					                       ToFDolbyIOAudioDevice(Device));
 				        else
-					        BroadcastEvent(OnCurrentAudioOutputDeviceChanged, !bIsDeviceNone,
+					        BroadcastEvent(*this, OnCurrentAudioOutputDeviceChanged, !bIsDeviceNone,
 					                       ToFDolbyIOAudioDevice(Device));
 				        return;
 			        }
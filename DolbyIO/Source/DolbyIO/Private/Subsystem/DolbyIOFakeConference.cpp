@@ -0,0 +1,380 @@
+// Copyright 2023 Dolby Laboratories
+
+#include "DolbyIOFakeConference.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "DolbyIO.h"
+#include "Utils/DolbyIOConversions.h"
+#include "Utils/DolbyIOLLM.h"
+#include "Utils/DolbyIOLogging.h"
+#include "Utils/DolbyIOStats.h"
+#include "Utils/DolbyIOTrace.h"
+#include "Video/DolbyIOVideoConversion.h"
+#include "Video/DolbyIOVideoSink.h"
+
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/Parse.h"
+
+namespace DolbyIO
+{
+	using namespace dolbyio::comms;
+
+	namespace
+	{
+		struct FSyntheticFrame
+		{
+			TArray<uint8> Buffer;
+			FVideoPlanes Planes;
+		};
+
+		std::shared_ptr<const FVideoPlanes> MakeSyntheticFrame(const FFakeConferenceSettings& Settings,
+		                                                       FRandomStream& Random)
+		{
+			const int Width = FMath::Max(Settings.VideoSize.X, 1);
+			const int Height = FMath::Max(Settings.VideoSize.Y, 1);
+			const std::shared_ptr<FSyntheticFrame> Frame = std::make_shared<FSyntheticFrame>();
+			Frame->Buffer.SetNumUninitialized(FVideoTexture::GetBufferSize(Width, Height, Settings.VideoFormat));
+			for (uint8& Value : Frame->Buffer)
+			{
+				Value = static_cast<uint8>(Random.RandHelper(256));
+			}
+			Frame->Planes = FVideoPlanes::FromPacked(Frame->Buffer.GetData(), Settings.VideoFormat, Width, Height);
+			return {Frame, &Frame->Planes};
+		}
+
+		participant_info MakeParticipantInfo(const FString& ParticipantID, int Index, participant_status Status,
+		                                     bool bIsSendingAudio)
+		{
+			participant_info Ret;
+			Ret.user_id = ToStdString(ParticipantID);
+			Ret.info.name = ToStdString(FString::Printf(TEXT("Fake participant %d"), Index));
+			Ret.info.external_id = ToStdString(FString::Printf(TEXT("fake-external-%d"), Index));
+			Ret.status = Status;
+			Ret.is_sending_audio = bIsSendingAudio;
+			Ret.audible_locally = true;
+			return Ret;
+		}
+	}
+
+	FFakeConference::FSchedule::FSchedule(float Rate, double Now)
+	    : Interval(Rate > 0.0f ? 1.0 / Rate : 0.0), NextTime(Rate > 0.0f ? Now : TNumericLimits<double>::Max())
+	{
+	}
+
+	bool FFakeConference::FSchedule::IsDue(double Now)
+	{
+		if (Now < NextTime)
+		{
+			return false;
+		}
+		// Events which could not be emitted in time are skipped rather than emitted in a burst
+		NextTime = FMath::Max(NextTime + Interval, Now);
+		return true;
+	}
+
+	FFakeConference::FFakeConference(UDolbyIOSubsystem& InSubsystem, const FFakeConferenceSettings& InSettings)
+	    : Subsystem(InSubsystem), Settings(InSettings), Random(InSettings.Seed)
+	{
+		if (Settings.NumVideoTracks > 0)
+		{
+			VideoFrame = MakeSyntheticFrame(Settings, Random);
+		}
+		Thread = FRunnableThread::Create(this, TEXT("DolbyIOFakeConference"));
+	}
+
+	FFakeConference::~FFakeConference()
+	{
+		if (Thread)
+		{
+			Thread->Kill(true);
+			delete Thread;
+		}
+	}
+
+	void FFakeConference::Create(UDolbyIOSubsystem& Subsystem, const FFakeConferenceSettings& Settings)
+	{
+		Destroy(Subsystem);
+		DLB_UE_LOG("Starting fake conference: %d participants, %d video tracks", Settings.NumParticipants,
+		           Settings.NumVideoTracks);
+		Subsystem.FakeConference = MakeShared<FFakeConference>(Subsystem, Settings);
+	}
+
+	void FFakeConference::Destroy(UDolbyIOSubsystem& Subsystem)
+	{
+		if (Subsystem.FakeConference)
+		{
+			DLB_UE_LOG("Stopping fake conference");
+			Subsystem.FakeConference.Reset();
+		}
+	}
+
+	uint32 FFakeConference::Run()
+	{
+		AddParticipants();
+
+		const double Now = FPlatformTime::Seconds();
+		FSchedule AudioLevels{Settings.AudioLevelsRate, Now};
+		FSchedule ActiveSpeakers{Settings.ActiveSpeakersRate, Now};
+		FSchedule ParticipantUpdates{Settings.ParticipantUpdateRate, Now};
+		FSchedule Messages{Settings.MessageRate, Now};
+		FSchedule VideoFrames{VideoFrame ? Settings.VideoFrameRate : 0.0f, Now};
+		while (!bIsStopping)
+		{
+			const double Time = FPlatformTime::Seconds();
+			if (AudioLevels.IsDue(Time))
+			{
+				EmitAudioLevels();
+			}
+			if (ActiveSpeakers.IsDue(Time))
+			{
+				EmitActiveSpeakers();
+			}
+			if (ParticipantUpdates.IsDue(Time))
+			{
+				EmitParticipantUpdate();
+			}
+			if (Messages.IsDue(Time))
+			{
+				EmitMessage();
+			}
+			if (VideoFrames.IsDue(Time))
+			{
+				EmitVideoFrames();
+			}
+
+			// Wakes up at least every 10 ms to notice being stopped
+			double NextTime = FPlatformTime::Seconds() + 0.01;
+			for (const FSchedule* Schedule :
+			     {&AudioLevels, &ActiveSpeakers, &ParticipantUpdates, &Messages, &VideoFrames})
+			{
+				NextTime = FMath::Min(NextTime, Schedule->NextTime);
+			}
+			FPlatformProcess::Sleep(static_cast<float>(FMath::Max(NextTime - FPlatformTime::Seconds(), 0.0)));
+		}
+
+		RemoveParticipants();
+		return 0;
+	}
+
+	void FFakeConference::Stop()
+	{
+		bIsStopping = true;
+	}
+
+	template <class TEvent> void FFakeConference::Handle(const TEvent& Event)
+	{
+		DLB_TRACE_SCOPE(HandleFakeEvent);
+		SCOPE_CYCLE_COUNTER(STAT_DolbyIO_HandleEvent);
+		LLM_SCOPE_BYTAG(DolbyIO_Events);
+		Subsystem.Handle(Event);
+	}
+
+	void FFakeConference::Handle(const remote_video_track_added& Event)
+	{
+		DLB_TRACE_SCOPE(HandleFakeEvent);
+		SCOPE_CYCLE_COUNTER(STAT_DolbyIO_HandleEvent);
+		LLM_SCOPE_BYTAG(DolbyIO_Events);
+		// The subsystem does not pass the sinks of fake video tracks to the SDK, they are fed by EmitVideoFrames
+		Subsystem.AddRemoteVideoTrack(Event.track, false);
+	}
+
+	FString FFakeConference::GetParticipantID(int Index)
+	{
+		return FString::Printf(TEXT("fake-participant-%d"), Index);
+	}
+
+	FString FFakeConference::GetVideoTrackID(int Index)
+	{
+		return FString::Printf(TEXT("fake-video-track-%d"), Index);
+	}
+
+	namespace
+	{
+		video_track MakeVideoTrack(const FString& VideoTrackID, const FString& ParticipantID)
+		{
+			video_track Ret;
+			Ret.peer_id = ToStdString(ParticipantID);
+			Ret.stream_id = ToStdString(VideoTrackID);
+			Ret.sdp_track_id = ToStdString(VideoTrackID);
+			Ret.is_screenshare = false;
+			return Ret;
+		}
+	}
+
+	void FFakeConference::AddParticipants()
+	{
+		const int NumParticipants = FMath::Max(Settings.NumParticipants, 1);
+		for (int i = 0; i < NumParticipants; ++i)
+		{
+			remote_participant_added Event;
+			Event.participant = MakeParticipantInfo(GetParticipantID(i), i, participant_status::on_air, true);
+			Handle(Event);
+		}
+		for (int i = 0; i < Settings.NumVideoTracks; ++i)
+		{
+			const FString VideoTrackID = GetVideoTrackID(i);
+			remote_video_track_added Event;
+			Event.track = MakeVideoTrack(VideoTrackID, GetParticipantID(i % NumParticipants));
+			Handle(Event);
+
+			FScopeLock Lock{&Subsystem.VideoSinksLock};
+			if (const std::shared_ptr<FVideoSink>* Sink = Subsystem.VideoSinks.Find(VideoTrackID))
+			{
+				FScopeLock SinksLock{&VideoSinksLock};
+				VideoSinks.Emplace(VideoTrackID, *Sink);
+			}
+		}
+	}
+
+	void FFakeConference::RemoveParticipants()
+	{
+		const int NumParticipants = FMath::Max(Settings.NumParticipants, 1);
+		for (int i = 0; i < Settings.NumVideoTracks; ++i)
+		{
+			remote_video_track_removed Event;
+			Event.track = MakeVideoTrack(GetVideoTrackID(i), GetParticipantID(i % NumParticipants));
+			Handle(Event);
+		}
+		{
+			FScopeLock Lock{&VideoSinksLock};
+			VideoSinks.Empty();
+		}
+		for (int i = 0; i < NumParticipants; ++i)
+		{
+			remote_participant_updated Event;
+			Event.participant = MakeParticipantInfo(GetParticipantID(i), i, participant_status::left, false);
+			Handle(Event);
+		}
+	}
+
+	void FFakeConference::EmitAudioLevels()
+	{
+		audio_levels Event;
+		for (int i = 0; i < FMath::Max(Settings.NumParticipants, 1); ++i)
+		{
+			Event.levels.push_back(audio_level{ToStdString(GetParticipantID(i)), Random.FRand()});
+		}
+		Handle(Event);
+	}
+
+	void FFakeConference::EmitActiveSpeakers()
+	{
+		active_speaker_changed Event;
+		const int NumParticipants = FMath::Max(Settings.NumParticipants, 1);
+		const int NumSpeakers = FMath::Min(NumParticipants, 3);
+		const int FirstSpeaker = Random.RandHelper(NumParticipants);
+		for (int i = 0; i < NumSpeakers; ++i)
+		{
+			Event.active_speakers.push_back(ToStdString(GetParticipantID((FirstSpeaker + i) % NumParticipants)));
+		}
+		Handle(Event);
+	}
+
+	void FFakeConference::EmitParticipantUpdate()
+	{
+		const int Index = Random.RandHelper(FMath::Max(Settings.NumParticipants, 1));
+		remote_participant_updated Event;
+		Event.participant =
+		    MakeParticipantInfo(GetParticipantID(Index), Index, participant_status::on_air, Random.RandHelper(2) != 0);
+		Handle(Event);
+	}
+
+	void FFakeConference::EmitMessage()
+	{
+		const int Index = Random.RandHelper(FMath::Max(Settings.NumParticipants, 1));
+		conference_message_received Event;
+		Event.user_id = ToStdString(GetParticipantID(Index));
+		Event.message = ToStdString(FString::Printf(TEXT("Fake message %d"), Random.RandHelper(1000000)));
+		Handle(Event);
+	}
+
+	void FFakeConference::EmitVideoFrames()
+	{
+		TArray<std::shared_ptr<FVideoSink>> Sinks;
+		{
+			FScopeLock Lock{&VideoSinksLock};
+			for (const auto& Sink : VideoSinks)
+			{
+				if (std::shared_ptr<FVideoSink> LockedSink = Sink.Value.lock())
+				{
+					Sinks.Add(MoveTemp(LockedSink));
+				}
+			}
+		}
+		for (const std::shared_ptr<FVideoSink>& Sink : Sinks)
+		{
+			Sink->HandleSyntheticFrame(VideoFrame);
+		}
+	}
+
+	namespace
+	{
+		UDolbyIOSubsystem* GetSubsystem(UWorld* World)
+		{
+			UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+			UDolbyIOSubsystem* Subsystem = GameInstance ? GameInstance->GetSubsystem<UDolbyIOSubsystem>() : nullptr;
+			if (!Subsystem)
+			{
+				DLB_UE_LOG_BASE(Warning, "Fake conference needs a running game instance");
+			}
+			return Subsystem;
+		}
+
+		void StartFakeConference(const TArray<FString>& Args, UWorld* World)
+		{
+			UDolbyIOSubsystem* Subsystem = GetSubsystem(World);
+			if (!Subsystem)
+			{
+				return;
+			}
+
+			const FString Cmd = FString::Join(Args, TEXT(" "));
+			FFakeConferenceSettings Settings;
+			FParse::Value(*Cmd, TEXT("Participants="), Settings.NumParticipants);
+			FParse::Value(*Cmd, TEXT("VideoTracks="), Settings.NumVideoTracks);
+			FParse::Value(*Cmd, TEXT("AudioLevelsRate="), Settings.AudioLevelsRate);
+			FParse::Value(*Cmd, TEXT("ActiveSpeakersRate="), Settings.ActiveSpeakersRate);
+			FParse::Value(*Cmd, TEXT("ParticipantUpdateRate="), Settings.ParticipantUpdateRate);
+			FParse::Value(*Cmd, TEXT("MessageRate="), Settings.MessageRate);
+			FParse::Value(*Cmd, TEXT("FrameRate="), Settings.VideoFrameRate);
+			FParse::Value(*Cmd, TEXT("Width="), Settings.VideoSize.X);
+			FParse::Value(*Cmd, TEXT("Height="), Settings.VideoSize.Y);
+			FParse::Value(*Cmd, TEXT("Seed="), Settings.Seed);
+			FString Format;
+			if (FParse::Value(*Cmd, TEXT("Format="), Format))
+			{
+				Settings.VideoFormat = Format == TEXT("NV12")   ? FVideoTexture::EBufferFormat::NV12
+				                       : Format == TEXT("ARGB") ? FVideoTexture::EBufferFormat::BGRA
+				                                                : FVideoTexture::EBufferFormat::I420;
+			}
+			FFakeConference::Create(*Subsystem, Settings);
+		}
+
+		void StopFakeConference(const TArray<FString>& Args, UWorld* World)
+		{
+			if (UDolbyIOSubsystem* Subsystem = GetSubsystem(World))
+			{
+				FFakeConference::Destroy(*Subsystem);
+			}
+		}
+
+		FAutoConsoleCommandWithWorldAndArgs StartFakeConferenceCommand(
+		    TEXT("DolbyIO.FakeConference.Start"),
+		    TEXT("Starts generating remote participants, video tracks and their events without the SDK. Optional ")
+		    TEXT("arguments (defaults): Participants=10 VideoTracks=0 AudioLevelsRate=10 ActiveSpeakersRate=1 ")
+		    TEXT("ParticipantUpdateRate=0 MessageRate=0 FrameRate=30 Width=1280 Height=720 Format=I420|NV12|ARGB ")
+		    TEXT("Seed=0."),
+		    FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&StartFakeConference));
+
+		FAutoConsoleCommandWithWorldAndArgs StopFakeConferenceCommand(
+		    TEXT("DolbyIO.FakeConference.Stop"),
+		    TEXT("Removes the participants and video tracks of the fake conference and stops generating events."),
+		    FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&StopFakeConference));
+	}
+}
+
+#endif
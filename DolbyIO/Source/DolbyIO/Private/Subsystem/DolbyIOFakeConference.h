@@ -0,0 +1,90 @@
+// Copyright 2023 Dolby Laboratories
+
+#pragma once
+
+#if !UE_BUILD_SHIPPING
+
+#include "DolbyIOCppSdkFwd.h"
+#include "Video/DolbyIOVideoTexture.h"
+
+#include "HAL/Runnable.h"
+#include "Math/IntPoint.h"
+#include "Math/RandomStream.h"
+
+#include <atomic>
+#include <memory>
+
+class FRunnableThread;
+class UDolbyIOSubsystem;
+
+namespace DolbyIO
+{
+	struct FVideoPlanes;
+	class FVideoSink;
+
+	struct FFakeConferenceSettings
+	{
+		int NumParticipants = 10;
+		int NumVideoTracks = 0;
+		/** Events per second, 0 means none. */
+		float AudioLevelsRate = 10.0f;
+		float ActiveSpeakersRate = 1.0f;
+		float ParticipantUpdateRate = 0.0f;
+		float MessageRate = 0.0f;
+		float VideoFrameRate = 30.0f;
+		FIntPoint VideoSize{1280, 720};
+		FVideoTexture::EBufferFormat VideoFormat = FVideoTexture::EBufferFormat::I420;
+		int32 Seed = 0;
+	};
+
+	/** Stands in for a conference without the SDK or a network: remote participants, their video tracks, audio
+	 * levels, active speakers, participant updates, messages and synthetic video frames are generated on a thread of
+	 * its own at the configured rates and handled by the subsystem exactly like the SDK's events. The subsystem's
+	 * calls into the SDK are not faked, so the subsystem does not need to be connected, but calls which need a
+	 * conference have no effect. */
+	class FFakeConference final : public FRunnable
+	{
+	public:
+		FFakeConference(UDolbyIOSubsystem& Subsystem, const FFakeConferenceSettings& Settings);
+		~FFakeConference();
+
+		// Must be called on the game thread, a running fake conference is replaced
+		static void Create(UDolbyIOSubsystem& Subsystem, const FFakeConferenceSettings& Settings);
+		static void Destroy(UDolbyIOSubsystem& Subsystem);
+
+	private:
+		uint32 Run() override;
+		void Stop() override;
+
+		struct FSchedule
+		{
+			FSchedule(float Rate, double Now);
+			bool IsDue(double Now);
+			double Interval;
+			double NextTime;
+		};
+
+		template <class TEvent> void Handle(const TEvent& Event);
+		void Handle(const dolbyio::comms::remote_video_track_added& Event);
+		static FString GetParticipantID(int Index);
+		static FString GetVideoTrackID(int Index);
+		void AddParticipants();
+		void RemoveParticipants();
+		void EmitAudioLevels();
+		void EmitActiveSpeakers();
+		void EmitParticipantUpdate();
+		void EmitMessage();
+		void EmitVideoFrames();
+
+		UDolbyIOSubsystem& Subsystem;
+		const FFakeConferenceSettings Settings;
+		FRandomStream Random;
+		std::shared_ptr<const FVideoPlanes> VideoFrame;
+		TMap<FString, std::weak_ptr<FVideoSink>> VideoSinks;
+		FCriticalSection VideoSinksLock;
+		std::atomic<bool> bIsStopping{false};
+		FRunnableThread* Thread = nullptr;
+	};
+}
+
+#endif
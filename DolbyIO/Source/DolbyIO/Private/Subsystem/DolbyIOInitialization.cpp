@@ -3,16 +3,25 @@
 #include "DolbyIO.h"
 
 #include "DolbyIODevices.h"
+#include "DolbyIOFakeConference.h"
+#include "Spatial/DolbyIOAudioCulling.h"
+#include "Spatial/DolbyIOSpatialSources.h"
 #include "Utils/DolbyIOBroadcastEvent.h"
 #include "Utils/DolbyIOConversions.h"
 #include "Utils/DolbyIOErrorHandler.h"
+#include "Utils/DolbyIOEventQueue.h"
+#include "Utils/DolbyIOLLM.h"
 #include "Utils/DolbyIOLogging.h"
+#include "Utils/DolbyIOStats.h"
+#include "Utils/DolbyIOTrace.h"
+#include "Video/DolbyIOVideoAtlas.h"
 #include "Video/DolbyIOVideoFrameHandler.h"
 #include "Video/DolbyIOVideoSink.h"
 
 #include "Engine/GameInstance.h"
 #include "Engine/World.h"
 #include "Interfaces/IPluginManager.h"
+#include "Misc/CoreDelegates.h"
 #include "Misc/EngineVersion.h"
 #include "Misc/Paths.h"
 #include "TimerManager.h"
@@ -25,32 +34,49 @@ void UDolbyIOSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
 
+	EventQueue = MakeShared<FEventQueue>();
+	SpatialSources = MakeShared<FSpatialSources>();
+	AudioCulling = MakeShared<FAudioCulling>(*this);
+	VideoAtlas = MakeShared<FVideoAtlas, ESPMode::ThreadSafe>();
 	ConferenceStatus = conference_status::destroyed;
 
 	{
 		FScopeLock Lock{&VideoSinksLock};
-		VideoSinks.Emplace(LocalCameraTrackID, std::make_shared<FVideoSink>(LocalCameraTrackID));
-		VideoSinks.Emplace(LocalScreenshareTrackID, std::make_shared<FVideoSink>(LocalScreenshareTrackID));
+		VideoSinks.Emplace(LocalCameraTrackID, std::make_shared<FVideoSink>(LocalCameraTrackID, VideoAtlas));
+		VideoSinks.Emplace(LocalScreenshareTrackID,
+		                   std::make_shared<FVideoSink>(LocalScreenshareTrackID, VideoAtlas));
 		LocalCameraFrameHandler = std::make_shared<FVideoFrameHandler>(VideoSinks[LocalCameraTrackID]);
 		LocalScreenshareFrameHandler = std::make_shared<FVideoFrameHandler>(VideoSinks[LocalScreenshareTrackID]);
 	}
 
 	FTimerManager& TimerManager = GetGameInstance()->GetTimerManager();
-	TimerManager.SetTimer(LocationTimerHandle, this, &UDolbyIOSubsystem::SetLocationUsingFirstPlayer, 0.1, true);
-	TimerManager.SetTimer(RotationTimerHandle, this, &UDolbyIOSubsystem::SetRotationUsingFirstPlayer, 0.01, true);
-
-	BroadcastEvent(OnTokenNeeded);
+	TimerManager.SetTimer(LocationTimerHandle, this, &UDolbyIOSubsystem::SetLocationUsingFirstPlayer,
+	                      LocationTimerInterval, true);
+	TimerManager.SetTimer(RotationTimerHandle, this, &UDolbyIOSubsystem::SetRotationUsingFirstPlayer,
+	                      RotationTimerInterval, true);
+	FlushRemotePlayerLocationsHandle =
+	    FCoreDelegates::OnEndFrame.AddUObject(this, &UDolbyIOSubsystem::FlushRemotePlayerLocations);
+
+	BroadcastEvent(*this, OnTokenNeeded);
 }
 
 void UDolbyIOSubsystem::Deinitialize()
 {
 	DLB_UE_LOG("Deinitializing");
+	StressTest.Reset();
+#if !UE_BUILD_SHIPPING
+	FFakeConference::Destroy(*this);
+#endif
+	EventQueue->Shutdown();
+	FCoreDelegates::OnEndFrame.Remove(FlushRemotePlayerLocationsHandle);
+	VideoAtlas.Reset();
 
 	FScopeLock Lock{&VideoSinksLock};
 	for (auto& Sink : VideoSinks)
 	{
 		Sink.Value->Disable(); // ignore new frames now on
 	}
+	bIsParallelVideoConversionEnabled = false;
 
 	Super::Deinitialize();
 }
@@ -139,7 +165,7 @@ void UDolbyIOSubsystem::Initialize(const FString& Token)
 		                                  {
 			                                  DLB_UE_LOG("Refresh token requested");
 			                                  RefreshTokenCb = TSharedPtr<refresh_token>(RefreshCb.release());
-			                                  BroadcastEvent(OnTokenNeeded);
+			                                  BroadcastEvent(*this, OnTokenNeeded);
 		                                  })
 		                          .release());
 	}
@@ -151,8 +177,18 @@ void UDolbyIOSubsystem::Initialize(const FString& Token)
 
 	Devices = MakeShared<FDevices>(*this, Sdk->device_management());
 
-#define DLB_REGISTER_HANDLER(Service, Event) \
-	[this](event_handler_id) { return Sdk->Service().add_event_handler([this](const Event& Event) { Handle(Event); }); }
+#define DLB_REGISTER_HANDLER(Service, Event)                   \
+	[this](event_handler_id)                                   \
+	{                                                          \
+		return Sdk->Service().add_event_handler(               \
+		    [this](const Event& Event)                         \
+		    {                                                  \
+			    DLB_TRACE_SCOPE(Handle_##Event);               \
+			    SCOPE_CYCLE_COUNTER(STAT_DolbyIO_HandleEvent); \
+			    LLM_SCOPE_BYTAG(DolbyIO_Events);               \
+			    Handle(Event);                                 \
+		    });                                                \
+	}
 
 	const FString ComponentName = "unreal-sdk";
 	const FString ComponentVersion = *IPluginManager::Get().FindPlugin("DolbyIO")->GetDescriptor().VersionName +
@@ -162,8 +198,12 @@ void UDolbyIOSubsystem::Initialize(const FString& Token)
 	    .then(
 	        [this](sdk::component_data)
 	        {
-		        return Sdk->conference().add_event_handler([this](const conference_status_updated& Event)
-		                                                   { UpdateStatus(Event.status); });
+		        return Sdk->conference().add_event_handler(
+		            [this](const conference_status_updated& Event)
+		            {
+			            DLB_TRACE_SCOPE(UpdateStatus);
+			            UpdateStatus(Event.status);
+		            });
 	        })
 	    .then(DLB_REGISTER_HANDLER(conference, active_speaker_changed))
 	    .then(DLB_REGISTER_HANDLER(device_management, audio_device_changed))
@@ -189,10 +229,15 @@ void UDolbyIOSubsystem::Initialize(const FString& Token)
 	        [this]
 #endif
 	        {
-		        utils::vfs_event::add_event_handler(*Sdk, [this](const utils::vfs_event& Event) { Handle(Event); });
+		        utils::vfs_event::add_event_handler(*Sdk,
+		                                            [this](const utils::vfs_event& Event)
+		                                            {
+			                                            DLB_TRACE_SCOPE(Handle_vfs_event);
+			                                            Handle(Event);
+		                                            });
 
 		        DLB_UE_LOG("Initialized");
-		        BroadcastEvent(OnInitialized);
+		        BroadcastEvent(*this, OnInitialized);
 	        })
 	    .on_error(DLB_ERROR_HANDLER(OnSetTokenError));
 }
@@ -0,0 +1,350 @@
+// Copyright 2023 Dolby Laboratories
+
+#include "DolbyIO.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && !UE_BUILD_SHIPPING
+
+#include "DolbyIOFakeConference.h"
+#include "Utils/DolbyIOEventQueue.h"
+#include "Utils/DolbyIOLogging.h"
+#include "Utils/DolbyIOStats.h"
+
+#include "Dom/JsonObject.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "RenderCore.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace DolbyIO
+{
+	/** Ramps the participants of a fake conference up step by step, measures each step over a number of engine
+	 * frames and reports how the plugin's costs scale with the number of participants. Owned by the subsystem, which
+	 * stops it when it is deinitialized. */
+	class FStressTest final
+	{
+	public:
+		struct FSettings
+		{
+			/** Numbers of participants, the first step measures the baseline without participants. */
+			TArray<int> Steps{0, 1, 2, 5, 10, 25, 50, 100, 150, 200};
+			FFakeConferenceSettings Conference;
+			double WarmupTime = 1.0;
+			double MeasureTime = 3.0;
+			FString Path;
+		};
+
+		FStressTest(UDolbyIOSubsystem& InSubsystem, FSettings&& InSettings)
+		    : Subsystem(InSubsystem), Settings(MoveTemp(InSettings))
+		{
+			OnEndFrameHandle = FCoreDelegates::OnEndFrame.AddRaw(this, &FStressTest::OnEndFrame);
+			StartStep();
+		}
+
+		~FStressTest()
+		{
+			Finish();
+		}
+
+		// Must be called on the game thread, a running stress test is replaced
+		static TWeakPtr<FStressTest> Start(UDolbyIOSubsystem& Subsystem, FSettings&& Settings)
+		{
+			Subsystem.StressTest.Reset();
+			DLB_UE_LOG("Starting stress test: %d steps up to %d participants, %d video tracks",
+			           Settings.Steps.Num() - 1, Settings.Steps.Last(), Settings.Conference.NumVideoTracks);
+			Subsystem.StressTest = MakeShared<FStressTest>(Subsystem, MoveTemp(Settings));
+			return Subsystem.StressTest;
+		}
+
+		bool IsDone() const
+		{
+			return bIsDone;
+		}
+
+		/** Returns the names of the metrics which scale superlinearly, once done. */
+		const TArray<FString>& GetSuperlinearMetrics() const
+		{
+			return SuperlinearMetrics;
+		}
+
+	private:
+		struct FStep
+		{
+			int NumParticipants = 0;
+			int NumFrames = 0;
+			double GameThreadTime = 0.0;
+			double MaxGameThreadTime = 0.0;
+			double RenderThreadTime = 0.0;
+			double EventQueueDepth = 0.0;
+			int64 MaxEventQueueDepth = 0;
+			int64 RemoteParticipantsSize = 0;
+			int64 VideoSinksSize = 0;
+			int64 BufferedVideoTracksSize = 0;
+		};
+
+		void Finish()
+		{
+			FCoreDelegates::OnEndFrame.Remove(OnEndFrameHandle);
+			FFakeConference::Destroy(Subsystem);
+			bIsDone = true;
+		}
+
+		void StartStep()
+		{
+			FStep& Step = Steps.AddDefaulted_GetRef();
+			Step.NumParticipants = Settings.Steps[CurrentStep];
+			StepStartTime = FPlatformTime::Seconds();
+			if (Step.NumParticipants)
+			{
+				FFakeConferenceSettings Conference = Settings.Conference;
+				Conference.NumParticipants = Step.NumParticipants;
+				Conference.NumVideoTracks = FMath::Min(Conference.NumVideoTracks, Step.NumParticipants);
+				FFakeConference::Create(Subsystem, Conference);
+			}
+			else
+			{
+				FFakeConference::Destroy(Subsystem);
+			}
+		}
+
+		void OnEndFrame()
+		{
+			const double Elapsed = FPlatformTime::Seconds() - StepStartTime;
+			if (Elapsed < Settings.WarmupTime)
+			{
+				return;
+			}
+
+			FStep& Step = Steps.Last();
+			const double GameThreadTime = FPlatformTime::ToMilliseconds(GGameThreadTime);
+			const int64 EventQueueDepth = Subsystem.EventQueue->Num();
+			++Step.NumFrames;
+			Step.GameThreadTime += GameThreadTime;
+			Step.MaxGameThreadTime = FMath::Max(Step.MaxGameThreadTime, GameThreadTime);
+			Step.RenderThreadTime += FPlatformTime::ToMilliseconds(GRenderThreadTime);
+			Step.EventQueueDepth += EventQueueDepth;
+			Step.MaxEventQueueDepth = FMath::Max(Step.MaxEventQueueDepth, EventQueueDepth);
+			if (Elapsed < Settings.WarmupTime + Settings.MeasureTime)
+			{
+				return;
+			}
+
+			{
+				FScopeLock Lock{&Subsystem.RemoteParticipantsLock};
+				Step.RemoteParticipantsSize = Subsystem.RemoteParticipants.GetAllocatedSize();
+			}
+			{
+				// Frame buffers and textures make up most of the memory of the video sinks
+				FScopeLock Lock{&Subsystem.VideoSinksLock};
+				Step.VideoSinksSize = Subsystem.VideoSinks.GetAllocatedSize() + VideoBufferMemory + VideoTextureMemory;
+				Step.BufferedVideoTracksSize = Subsystem.BufferedAddedVideoTracks.GetAllocatedSize();
+				for (const auto& Tracks : Subsystem.BufferedAddedVideoTracks)
+				{
+					Step.BufferedVideoTracksSize += Tracks.Value.GetAllocatedSize();
+				}
+			}
+			Step.GameThreadTime /= Step.NumFrames;
+			Step.RenderThreadTime /= Step.NumFrames;
+			Step.EventQueueDepth /= Step.NumFrames;
+			DLB_UE_LOG("Stress test %d participants: game thread %.2f ms, render thread %.2f ms, event queue %.1f",
+			           Step.NumParticipants, Step.GameThreadTime, Step.RenderThreadTime, Step.EventQueueDepth);
+
+			if (++CurrentStep < Settings.Steps.Num())
+			{
+				StartStep();
+			}
+			else
+			{
+				Report();
+				Finish();
+			}
+		}
+
+		using FGetMetric = TFunction<double(const FStep&)>;
+
+		/** Returns the exponent of the best power law fit of the metric's growth over the baseline against the number
+		 * of participants. Above 1 the metric grows superlinearly. */
+		double GetScalingExponent(const FGetMetric& GetMetric) const
+		{
+			const double Baseline = GetMetric(Steps[0]);
+			double SumX = 0.0, SumY = 0.0, SumXX = 0.0, SumXY = 0.0;
+			int Count = 0;
+			for (int i = 1; i < Steps.Num(); ++i)
+			{
+				const double Growth = GetMetric(Steps[i]) - Baseline;
+				if (Growth <= 0.0)
+				{
+					continue;
+				}
+				const double X = FMath::Loge(static_cast<double>(Steps[i].NumParticipants));
+				const double Y = FMath::Loge(Growth);
+				SumX += X;
+				SumY += Y;
+				SumXX += X * X;
+				SumXY += X * Y;
+				++Count;
+			}
+			const double Denominator = Count * SumXX - SumX * SumX;
+			return Count >= 2 && Denominator > 0.0 ? (Count * SumXY - SumX * SumY) / Denominator : 0.0;
+		}
+
+		void Report()
+		{
+			TArray<TSharedPtr<FJsonValue>> StepValues;
+			for (const FStep& Step : Steps)
+			{
+				const TSharedRef<FJsonObject> Value = MakeShared<FJsonObject>();
+				Value->SetNumberField(TEXT("participants"), Step.NumParticipants);
+				Value->SetNumberField(TEXT("frames"), Step.NumFrames);
+				Value->SetNumberField(TEXT("game_thread_ms"), Step.GameThreadTime);
+				Value->SetNumberField(TEXT("max_game_thread_ms"), Step.MaxGameThreadTime);
+				Value->SetNumberField(TEXT("render_thread_ms"), Step.RenderThreadTime);
+				Value->SetNumberField(TEXT("event_queue_depth"), Step.EventQueueDepth);
+				Value->SetNumberField(TEXT("max_event_queue_depth"), Step.MaxEventQueueDepth);
+				Value->SetNumberField(TEXT("remote_participants_bytes"), Step.RemoteParticipantsSize);
+				Value->SetNumberField(TEXT("video_sinks_bytes"), Step.VideoSinksSize);
+				Value->SetNumberField(TEXT("buffered_video_tracks_bytes"), Step.BufferedVideoTracksSize);
+				StepValues.Add(MakeShared<FJsonValueObject>(Value));
+			}
+
+			// Exponents are noisy for small costs, so a metric is only flagged when clearly above linear
+			constexpr double SuperlinearThreshold = 1.2;
+			const TSharedRef<FJsonObject> Scaling = MakeShared<FJsonObject>();
+			auto AddScaling = [&](const TCHAR* Name, const FGetMetric& GetMetric)
+			{
+				const double Exponent = GetScalingExponent(GetMetric);
+				Scaling->SetNumberField(Name, Exponent);
+				if (Exponent > SuperlinearThreshold)
+				{
+					SuperlinearMetrics.Add(Name);
+					DLB_UE_LOG_BASE(Warning, "Stress test: %s scales superlinearly (exponent %.2f)", Name, Exponent);
+				}
+			};
+			AddScaling(TEXT("game_thread_ms"), [](const FStep& Step) { return Step.GameThreadTime; });
+			AddScaling(TEXT("render_thread_ms"), [](const FStep& Step) { return Step.RenderThreadTime; });
+			AddScaling(TEXT("event_queue_depth"), [](const FStep& Step) { return Step.EventQueueDepth; });
+			AddScaling(TEXT("remote_participants_bytes"),
+			           [](const FStep& Step) { return static_cast<double>(Step.RemoteParticipantsSize); });
+			AddScaling(TEXT("video_sinks_bytes"),
+			           [](const FStep& Step) { return static_cast<double>(Step.VideoSinksSize); });
+
+			const TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+			Result->SetNumberField(TEXT("video_tracks"), Settings.Conference.NumVideoTracks);
+			Result->SetNumberField(TEXT("audio_levels_rate"), Settings.Conference.AudioLevelsRate);
+			Result->SetNumberField(TEXT("participant_update_rate"), Settings.Conference.ParticipantUpdateRate);
+			Result->SetNumberField(TEXT("message_rate"), Settings.Conference.MessageRate);
+			Result->SetNumberField(TEXT("measure_seconds"), Settings.MeasureTime);
+			Result->SetArrayField(TEXT("steps"), StepValues);
+			Result->SetObjectField(TEXT("scaling_exponents"), Scaling);
+			TArray<TSharedPtr<FJsonValue>> SuperlinearValues;
+			for (const FString& Name : SuperlinearMetrics)
+			{
+				SuperlinearValues.Add(MakeShared<FJsonValueString>(Name));
+			}
+			Result->SetArrayField(TEXT("superlinear"), SuperlinearValues);
+
+			FString Json;
+			FJsonSerializer::Serialize(Result, TJsonWriterFactory<>::Create(&Json));
+			DLB_UE_LOG("%s", *Json);
+			if (FFileHelper::SaveStringToFile(Json, *Settings.Path))
+			{
+				DLB_UE_LOG("Saved stress test results to %s", *Settings.Path);
+			}
+			else
+			{
+				DLB_UE_LOG_BASE(Warning, "Failed to save stress test results to %s", *Settings.Path);
+			}
+		}
+
+		UDolbyIOSubsystem& Subsystem;
+		const FSettings Settings;
+		TArray<FStep> Steps;
+		int CurrentStep = 0;
+		double StepStartTime = 0.0;
+		FDelegateHandle OnEndFrameHandle;
+		TArray<FString> SuperlinearMetrics;
+		bool bIsDone = false;
+	};
+
+	DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(FWaitForStressTest, FAutomationTestBase*, Test,
+	                                               TWeakPtr<FStressTest>, StressTest);
+
+	bool FWaitForStressTest::Update()
+	{
+		const TSharedPtr<FStressTest> Running = StressTest.Pin();
+		if (!Running)
+		{
+			Test->AddError(TEXT("The stress test was stopped before it finished"));
+			return true;
+		}
+		if (!Running->IsDone())
+		{
+			return false;
+		}
+		for (const FString& Name : Running->GetSuperlinearMetrics())
+		{
+			Test->AddError(FString::Printf(TEXT("%s scales superlinearly with the number of participants"), *Name));
+		}
+		return true;
+	}
+
+	namespace
+	{
+		UDolbyIOSubsystem* FindSubsystem()
+		{
+			for (const FWorldContext& Context : GEngine->GetWorldContexts())
+			{
+				if ((Context.WorldType == EWorldType::Game || Context.WorldType == EWorldType::PIE) &&
+				    Context.OwningGameInstance)
+				{
+					if (UDolbyIOSubsystem* Subsystem = Context.OwningGameInstance->GetSubsystem<UDolbyIOSubsystem>())
+					{
+						return Subsystem;
+					}
+				}
+			}
+			return nullptr;
+		}
+	}
+
+	// Flagged as a performance test, runs in a game or PIE session and saves the results to
+	// Saved/Profiling/DolbyIO
+	IMPLEMENT_COMPLEX_AUTOMATION_TEST(FDolbyIOStressTest, "DolbyIO.StressTest",
+	                                  EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+	                                      EAutomationTestFlags::PerfFilter);
+
+	void FDolbyIOStressTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+	{
+		for (const int NumVideoTracks : {0, 25})
+		{
+			OutBeautifiedNames.Add(FString::Printf(TEXT("%dVideoTracks"), NumVideoTracks));
+			OutTestCommands.Add(FString::FromInt(NumVideoTracks));
+		}
+	}
+
+	bool FDolbyIOStressTest::RunTest(const FString& Parameters)
+	{
+		UDolbyIOSubsystem* Subsystem = FindSubsystem();
+		if (!Subsystem)
+		{
+			AddError(TEXT("The stress test needs a running game instance, run it in a game or PIE session"));
+			return false;
+		}
+
+		FStressTest::FSettings Settings;
+		Settings.Conference.NumVideoTracks = FCString::Atoi(*Parameters);
+		Settings.Conference.AudioLevelsRate = 10.0f;
+		Settings.Conference.ParticipantUpdateRate = 5.0f;
+		Settings.Conference.MessageRate = 2.0f;
+		Settings.Path = FPaths::Combine(FPaths::ProfilingDir(), TEXT("DolbyIO"),
+		                                FString::Printf(TEXT("StressTest%sVideoTracks.json"), *Parameters));
+		ADD_LATENT_AUTOMATION_COMMAND(FWaitForStressTest(this, FStressTest::Start(*Subsystem, MoveTemp(Settings))));
+		return true;
+	}
+}
+
+#endif
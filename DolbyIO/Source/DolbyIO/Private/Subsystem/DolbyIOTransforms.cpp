@@ -0,0 +1,277 @@
+// Copyright 2023 Dolby Laboratories
+
+#include "DolbyIO.h"
+
+#include "DolbyIOSpatialListenerComponent.h"
+#include "Spatial/DolbyIOAudioCulling.h"
+#include "Spatial/DolbyIOSpatialSources.h"
+#include "Utils/DolbyIOConversions.h"
+#include "Utils/DolbyIOErrorHandler.h"
+#include "Utils/DolbyIOLogging.h"
+#include "Utils/DolbyIOStats.h"
+
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "TimerManager.h"
+
+using namespace DolbyIO;
+
+namespace
+{
+	TAutoConsoleVariable<float> CVarListenerLocationThreshold(
+	    TEXT("DolbyIO.ListenerLocationThreshold"), 1.0f,
+	    TEXT("Distance in units the first player must move before its new location is set automatically."));
+	TAutoConsoleVariable<float> CVarListenerRotationThreshold(
+	    TEXT("DolbyIO.ListenerRotationThreshold"), 0.5f,
+	    TEXT("Angle in degrees the first player must turn before its new rotation is set automatically."));
+	TAutoConsoleVariable<float> CVarListenerMaxIntervalScale(
+	    TEXT("DolbyIO.ListenerMaxIntervalScale"), 4.0f,
+	    TEXT("While the first player stays still, the interval at which its location and rotation are checked ")
+	    TEXT("doubles up to this many times the default. 1 = constant interval."));
+}
+
+void UDolbyIOSubsystem::SetLocalPlayerLocation(const FVector& Location)
+{
+	if (LocationTimerHandle.IsValid())
+	{
+		DLB_UE_LOG("Disabling automatic location setting");
+		GetGameInstance()->GetTimerManager().ClearTimer(LocationTimerHandle);
+	}
+	SetLocalPlayerLocationImpl(Location);
+}
+
+void UDolbyIOSubsystem::SetLocalPlayerLocationImpl(const FVector& Location)
+{
+	SCOPE_CYCLE_COUNTER(STAT_DolbyIO_SpatialUpdate);
+
+	if (!IsConnectedAsActive() || !IsSpatialAudio())
+	{
+		return;
+	}
+
+	Sdk->conference()
+	    .set_spatial_position(ToStdString(LocalParticipantID), {Location.X, Location.Y, Location.Z})
+	    .on_error(DLB_ERROR_HANDLER(OnSetLocalPlayerLocationError));
+	AudioCulling->SetListenerLocation(Location);
+}
+
+void UDolbyIOSubsystem::SetLocalPlayerRotation(const FRotator& Rotation)
+{
+	if (RotationTimerHandle.IsValid())
+	{
+		DLB_UE_LOG("Disabling automatic rotation setting");
+		GetGameInstance()->GetTimerManager().ClearTimer(RotationTimerHandle);
+	}
+	SetLocalPlayerRotationImpl(Rotation);
+}
+
+void UDolbyIOSubsystem::SetLocalPlayerRotationImpl(const FRotator& Rotation)
+{
+	SCOPE_CYCLE_COUNTER(STAT_DolbyIO_SpatialUpdate);
+
+	if (!IsConnectedAsActive() || !IsSpatialAudio())
+	{
+		return;
+	}
+
+	// The SDK expects the direction values to mean rotations around the {x,y,z} axes as specified by the
+	// environment. In Unreal, rotation around x is roll (because x is forward), y is pitch and z is yaw.
+	Sdk->conference()
+	    .set_spatial_direction({Rotation.Roll, Rotation.Pitch, Rotation.Yaw})
+	    .on_error(DLB_ERROR_HANDLER(OnSetLocalPlayerRotationError));
+}
+
+void UDolbyIOSubsystem::SetRemotePlayerLocation(const FString& ParticipantID, const FVector& Location)
+{
+	if (!IsConnectedAsActive() || SpatialAudioStyle != EDolbyIOSpatialAudioStyle::Individual ||
+	    ParticipantID == LocalParticipantID)
+	{
+		return;
+	}
+
+	PendingRemotePlayerLocations.Add(ParticipantID, Location);
+}
+
+void UDolbyIOSubsystem::SetRemotePlayerLocations(const TMap<FString, FVector>& Locations)
+{
+	if (!IsConnectedAsActive() || SpatialAudioStyle != EDolbyIOSpatialAudioStyle::Individual)
+	{
+		return;
+	}
+
+	for (const TPair<FString, FVector>& Location : Locations)
+	{
+		if (Location.Key != LocalParticipantID)
+		{
+			PendingRemotePlayerLocations.Add(Location.Key, Location.Value);
+		}
+	}
+}
+
+void UDolbyIOSubsystem::SetRemoteAudioCullingDistance(float Distance, float Hysteresis)
+{
+	DLB_UE_LOG("Setting remote audio culling distance to %f with hysteresis %f", Distance, Hysteresis);
+	AudioCulling->SetDistance(Distance, Hysteresis);
+}
+
+void UDolbyIOSubsystem::FlushRemotePlayerLocations()
+{
+	SpatialSources->Collect(*this);
+	if (PendingRemotePlayerLocations.Num())
+	{
+		SCOPE_CYCLE_COUNTER(STAT_DolbyIO_SpatialUpdate);
+
+		if (IsConnectedAsActive() && SpatialAudioStyle == EDolbyIOSpatialAudioStyle::Individual)
+		{
+			dolbyio::comms::spatial_audio_batch_update Update;
+			for (const TPair<FString, FVector>& Location : PendingRemotePlayerLocations)
+			{
+				Update.set_spatial_position(ToStdString(Location.Key),
+				                            {Location.Value.X, Location.Value.Y, Location.Value.Z});
+				AudioCulling->SetParticipantLocation(Location.Key, Location.Value);
+			}
+			Sdk->conference()
+			    .update_spatial_audio_configuration(MoveTemp(Update))
+			    .on_error(DLB_ERROR_HANDLER(OnSetRemotePlayerLocationError));
+		}
+		PendingRemotePlayerLocations.Reset();
+	}
+	AudioCulling->Update();
+}
+
+namespace
+{
+	APawn* GetFirstPlayerPawn(UGameInstance* GameInstance)
+	{
+		if (UWorld* World = GameInstance->GetWorld())
+		{
+			if (APlayerController* FirstPlayerController = World->GetFirstPlayerController())
+			{
+				return FirstPlayerController->GetPawn();
+			}
+		}
+		return nullptr;
+	}
+}
+
+void UDolbyIOSubsystem::SetLocationUsingFirstPlayer()
+{
+	if (!IsConnectedAsActive() || !IsSpatialAudio())
+	{
+		LastAutomaticLocation.Reset();
+		return;
+	}
+	if (APawn* Pawn = GetFirstPlayerPawn(GetGameInstance()))
+	{
+		const bool bIsIdle = !SetAutomaticLocation(Pawn->GetActorLocation());
+		UpdateTimerInterval(LocationTimerHandle, &UDolbyIOSubsystem::SetLocationUsingFirstPlayer,
+		                    LocationTimerInterval, bIsIdle);
+	}
+}
+
+void UDolbyIOSubsystem::SetRotationUsingFirstPlayer()
+{
+	if (!IsConnectedAsActive() || !IsSpatialAudio())
+	{
+		LastAutomaticRotation.Reset();
+		return;
+	}
+	if (APawn* Pawn = GetFirstPlayerPawn(GetGameInstance()))
+	{
+		const bool bIsIdle = !SetAutomaticRotation(Pawn->GetActorRotation());
+		UpdateTimerInterval(RotationTimerHandle, &UDolbyIOSubsystem::SetRotationUsingFirstPlayer,
+		                    RotationTimerInterval, bIsIdle);
+	}
+}
+
+bool UDolbyIOSubsystem::SetAutomaticLocation(const FVector& Location, bool bForce)
+{
+	const float Threshold = CVarListenerLocationThreshold.GetValueOnGameThread();
+	if (!bForce && LastAutomaticLocation &&
+	    FVector::DistSquared(Location, *LastAutomaticLocation) < FMath::Square(Threshold))
+	{
+		INC_DWORD_STAT(STAT_DolbyIO_SuppressedListenerUpdates);
+		return false;
+	}
+	LastAutomaticLocation = Location;
+	SetLocalPlayerLocationImpl(Location);
+	return true;
+}
+
+bool UDolbyIOSubsystem::SetAutomaticRotation(const FRotator& Rotation, bool bForce)
+{
+	const float Threshold = CVarListenerRotationThreshold.GetValueOnGameThread();
+	if (!bForce && LastAutomaticRotation &&
+	    FMath::RadiansToDegrees(Rotation.Quaternion().AngularDistance(LastAutomaticRotation->Quaternion())) < Threshold)
+	{
+		INC_DWORD_STAT(STAT_DolbyIO_SuppressedListenerUpdates);
+		return false;
+	}
+	LastAutomaticRotation = Rotation;
+	SetLocalPlayerRotationImpl(Rotation);
+	return true;
+}
+
+void UDolbyIOSubsystem::UpdateTimerInterval(FTimerHandle& Handle, void (UDolbyIOSubsystem::*Callback)(),
+                                            float DefaultInterval, bool bIsIdle)
+{
+	FTimerManager& TimerManager = GetGameInstance()->GetTimerManager();
+	const float Interval = TimerManager.GetTimerRate(Handle);
+	const float MaxInterval = DefaultInterval * FMath::Max(CVarListenerMaxIntervalScale.GetValueOnGameThread(), 1.0f);
+	const float NewInterval = bIsIdle ? FMath::Min(Interval * 2.0f, MaxInterval) : DefaultInterval;
+	if (!FMath::IsNearlyEqual(NewInterval, Interval))
+	{
+		TimerManager.SetTimer(Handle, this, Callback, NewInterval, true);
+	}
+}
+
+void UDolbyIOSubsystem::AddListenerComponent(UDolbyIOSpatialListenerComponent& Listener)
+{
+	ListenerComponents.RemoveAll([&Listener](const TWeakObjectPtr<UDolbyIOSpatialListenerComponent>& Other)
+	                             { return !Other.IsValid() || Other.Get() == &Listener; });
+	if (!ListenerComponents.Num())
+	{
+		FTimerManager& TimerManager = GetGameInstance()->GetTimerManager();
+		TimerManager.PauseTimer(LocationTimerHandle);
+		TimerManager.PauseTimer(RotationTimerHandle);
+	}
+	ListenerComponents.Add(&Listener);
+	SetListenerTransform(Listener, Listener.GetComponentTransform(), true);
+}
+
+void UDolbyIOSubsystem::RemoveListenerComponent(UDolbyIOSpatialListenerComponent& Listener)
+{
+	ListenerComponents.RemoveAll([&Listener](const TWeakObjectPtr<UDolbyIOSpatialListenerComponent>& Other)
+	                             { return !Other.IsValid() || Other.Get() == &Listener; });
+	if (ListenerComponents.Num())
+	{
+		const UDolbyIOSpatialListenerComponent& Current = *ListenerComponents.Last();
+		SetListenerTransform(Current, Current.GetComponentTransform(), true);
+	}
+	else
+	{
+		FTimerManager& TimerManager = GetGameInstance()->GetTimerManager();
+		TimerManager.UnPauseTimer(LocationTimerHandle);
+		TimerManager.UnPauseTimer(RotationTimerHandle);
+	}
+}
+
+void UDolbyIOSubsystem::SetListenerTransform(const UDolbyIOSpatialListenerComponent& Listener,
+                                             const FTransform& Transform, bool bForce)
+{
+	if (!ListenerComponents.Num() || ListenerComponents.Last().Get() != &Listener)
+	{
+		return;
+	}
+	if (!IsConnectedAsActive() || !IsSpatialAudio())
+	{
+		LastAutomaticLocation.Reset();
+		LastAutomaticRotation.Reset();
+		return;
+	}
+	SetAutomaticLocation(Transform.GetLocation(), bForce);
+	SetAutomaticRotation(Transform.Rotator(), bForce);
+}
@@ -0,0 +1,311 @@
+// Copyright 2023 Dolby Laboratories
+
+#include "DolbyIO.h"
+
+#include "DolbyIOVideoShaders.h"
+#include "Utils/DolbyIOBroadcastEvent.h"
+#include "Utils/DolbyIOConversions.h"
+#include "Utils/DolbyIOErrorHandler.h"
+#include "Utils/DolbyIOLogging.h"
+#include "Video/DolbyIOVideoAtlas.h"
+#include "Video/DolbyIOVideoSink.h"
+
+#include "Engine/GameInstance.h"
+#include "TimerManager.h"
+
+using namespace dolbyio::comms;
+using namespace DolbyIO;
+
+void UDolbyIOSubsystem::BindMaterial(UMaterialInstanceDynamic* Material, const FString& VideoTrackID)
+{
+	FScopeLock Lock{&VideoSinksLock};
+	for (auto& Sink : VideoSinks)
+	{
+		if (Sink.Key != VideoTrackID)
+		{
+			Sink.Value->UnbindMaterial(Material);
+		}
+	}
+
+	if (const std::shared_ptr<DolbyIO::FVideoSink>* Sink = VideoSinks.Find(VideoTrackID))
+	{
+		(*Sink)->BindMaterial(Material);
+	}
+}
+
+void UDolbyIOSubsystem::UnbindMaterial(UMaterialInstanceDynamic* Material, const FString& VideoTrackID)
+{
+	FScopeLock Lock{&VideoSinksLock};
+	if (const std::shared_ptr<DolbyIO::FVideoSink>* Sink = VideoSinks.Find(VideoTrackID))
+	{
+		(*Sink)->UnbindMaterial(Material);
+	}
+}
+
+UTexture2D* UDolbyIOSubsystem::GetTexture(const FString& VideoTrackID)
+{
+	FScopeLock Lock{&VideoSinksLock};
+	if (const std::shared_ptr<FVideoSink>* Sink = VideoSinks.Find(VideoTrackID))
+	{
+		return (*Sink)->GetTexture();
+	}
+	return nullptr;
+}
+
+void UDolbyIOSubsystem::SetVideoConversionMode(EDolbyIOVideoConversionMode ConversionMode)
+{
+	if (ConversionMode == EDolbyIOVideoConversionMode::GPU && !IsGpuConversionSupported())
+	{
+		DLB_UE_LOG_BASE(Warning, "GPU video conversion not supported on this platform, falling back to CPU");
+		ConversionMode = EDolbyIOVideoConversionMode::CPU;
+	}
+
+	DLB_UE_LOG("Converting video frames on %s",
+	           ConversionMode == EDolbyIOVideoConversionMode::GPU ? TEXT("GPU") : TEXT("CPU"));
+	VideoConversionMode = ConversionMode;
+
+	FScopeLock Lock{&VideoSinksLock};
+	for (auto& Sink : VideoSinks)
+	{
+		Sink.Value->SetConversionMode(ConversionMode);
+	}
+}
+
+void UDolbyIOSubsystem::SetParallelVideoConversionEnabled(bool bEnabled)
+{
+	DLB_UE_LOG("Setting parallel video conversion enabled: %d", bEnabled);
+	bIsParallelVideoConversionEnabled = bEnabled;
+
+	FScopeLock Lock{&VideoSinksLock};
+	for (auto& Sink : VideoSinks)
+	{
+		Sink.Value->SetParallelConversion(bEnabled);
+	}
+}
+
+void UDolbyIOSubsystem::SetVideoAtlasEnabled(bool bEnabled, int CellWidth, int CellHeight)
+{
+	DLB_UE_LOG("Setting video atlas enabled: %d cell size: %dx%d", bEnabled, CellWidth, CellHeight);
+	VideoAtlas->SetEnabled(bEnabled, {CellWidth, CellHeight});
+}
+
+void UDolbyIOSubsystem::SetVideoVisibilityCullingEnabled(bool bEnabled)
+{
+	DLB_UE_LOG("Setting video visibility culling enabled: %d", bEnabled);
+	FTimerManager& TimerManager = GetGameInstance()->GetTimerManager();
+	if (bEnabled)
+	{
+		TimerManager.SetTimer(VisibilityTimerHandle, this, &UDolbyIOSubsystem::UpdateVideoSinksVisibility, 0.1, true);
+		return;
+	}
+
+	TimerManager.ClearTimer(VisibilityTimerHandle);
+	FScopeLock Lock{&VideoSinksLock};
+	for (auto& Sink : VideoSinks)
+	{
+		Sink.Value->ResetVisibility();
+	}
+}
+
+void UDolbyIOSubsystem::UpdateVideoSinksVisibility()
+{
+	FScopeLock Lock{&VideoSinksLock};
+	for (auto& Sink : VideoSinks)
+	{
+		Sink.Value->UpdateVisibility();
+	}
+}
+
+void UDolbyIOSubsystem::SetVideoTrackMaxResolution(const FString& VideoTrackID, int MaxWidth, int MaxHeight)
+{
+	FScopeLock Lock{&VideoSinksLock};
+	if (const std::shared_ptr<FVideoSink>* Sink = VideoSinks.Find(VideoTrackID))
+	{
+		DLB_UE_LOG("Setting max resolution of video track ID %s to %dx%d", *VideoTrackID, MaxWidth, MaxHeight);
+		(*Sink)->SetMaxResolution(MaxWidth, MaxHeight);
+	}
+	else
+	{
+		DLB_UE_LOG_BASE(Warning, "Cannot set max resolution of non-existent video track ID %s", *VideoTrackID);
+	}
+}
+
+void UDolbyIOSubsystem::SetVideoTrackMaxFrameRate(const FString& VideoTrackID, float MaxFrameRate)
+{
+	FScopeLock Lock{&VideoSinksLock};
+	if (const std::shared_ptr<FVideoSink>* Sink = VideoSinks.Find(VideoTrackID))
+	{
+		DLB_UE_LOG("Setting max frame rate of video track ID %s to %f", *VideoTrackID, MaxFrameRate);
+		(*Sink)->SetMaxFrameRate(MaxFrameRate);
+	}
+	else
+	{
+		DLB_UE_LOG_BASE(Warning, "Cannot set max frame rate of non-existent video track ID %s", *VideoTrackID);
+	}
+}
+
+int64 UDolbyIOSubsystem::GetVideoTrackDroppedFrameCount(const FString& VideoTrackID)
+{
+	FScopeLock Lock{&VideoSinksLock};
+	if (const std::shared_ptr<FVideoSink>* Sink = VideoSinks.Find(VideoTrackID))
+	{
+		return (*Sink)->GetDroppedFrameCount();
+	}
+	return 0;
+}
+
+TArray<FDolbyIOVideoTrackStats> UDolbyIOSubsystem::GetVideoTrackStats()
+{
+	TArray<FDolbyIOVideoTrackStats> Stats;
+	FScopeLock Lock{&VideoSinksLock};
+	for (auto& Sink : VideoSinks)
+	{
+		Stats.Add(Sink.Value->GetStats());
+	}
+	return Stats;
+}
+
+void UDolbyIOSubsystem::BroadcastVideoTrackAdded(const FDolbyIOVideoTrack& VideoTrack)
+{
+	DLB_UE_LOG("Video track added: TrackID=%s ParticipantID=%s", *VideoTrack.TrackID, *VideoTrack.ParticipantID);
+	WarnIfVideoTrackSuspicious(VideoTrack.TrackID);
+	BroadcastEvent(*this, OnVideoTrackAdded, VideoTrack);
+}
+
+void UDolbyIOSubsystem::WarnIfVideoTrackSuspicious(const FString& VideoTrackID)
+{
+	if (VideoTrackID == "{-}")
+	{
+		DLB_UE_LOG_BASE(Warning, "Suspicious video track ID added, things may not work as expected");
+	}
+}
+
+void UDolbyIOSubsystem::BroadcastVideoTrackEnabled(const FDolbyIOVideoTrack& VideoTrack)
+{
+	DLB_UE_LOG("Video track enabled: TrackID=%s ParticipantID=%s", *VideoTrack.TrackID, *VideoTrack.ParticipantID);
+	BroadcastEvent(*this, OnVideoTrackEnabled, VideoTrack);
+}
+
+void UDolbyIOSubsystem::ProcessBufferedVideoTracks(const FString& ParticipantID)
+{
+	if (TArray<FDolbyIOVideoTrack>* AddedTracks = BufferedAddedVideoTracks.Find(ParticipantID))
+	{
+		FScopeLock Lock{&VideoSinksLock};
+		for (const FDolbyIOVideoTrack& AddedTrack : *AddedTracks)
+		{
+			if (std::shared_ptr<DolbyIO::FVideoSink>* Sink = VideoSinks.Find(AddedTrack.TrackID))
+			{
+				(*Sink)->OnTextureCreated([this, AddedTrack] { ProcessVideoTrackTextureCreated(AddedTrack); });
+			}
+		}
+		BufferedAddedVideoTracks.Remove(ParticipantID);
+	}
+}
+
+void UDolbyIOSubsystem::ProcessVideoTrackTextureCreated(const FDolbyIOVideoTrack& VideoTrack)
+{
+	BroadcastVideoTrackAdded(VideoTrack);
+
+	// Runs on the game thread or on the thread registering the callback, while the SDK event thread buffers
+	FScopeLock Lock{&VideoSinksLock};
+	if (TArray<FDolbyIOVideoTrack>* EnabledTracks = BufferedEnabledVideoTracks.Find(VideoTrack.ParticipantID))
+	{
+		TArray<FDolbyIOVideoTrack>& EnabledTracksRef = *EnabledTracks;
+		for (int i = 0; i < EnabledTracksRef.Num(); ++i)
+		{
+			if (EnabledTracksRef[i].TrackID == VideoTrack.TrackID)
+			{
+				BroadcastVideoTrackEnabled(EnabledTracksRef[i]);
+				EnabledTracksRef.RemoveAt(i);
+				if (!EnabledTracksRef.Num())
+				{
+					BufferedEnabledVideoTracks.Remove(VideoTrack.ParticipantID);
+				}
+				return;
+			}
+		}
+	}
+}
+
+void UDolbyIOSubsystem::Handle(const remote_video_track_added& Event)
+{
+	AddRemoteVideoTrack(Event.track, true);
+}
+
+void UDolbyIOSubsystem::AddRemoteVideoTrack(const video_track& Track, bool bIsFromSdk)
+{
+	const FDolbyIOVideoTrack VideoTrack = ToFDolbyIOVideoTrack(Track);
+
+	FScopeLock Lock1{&VideoSinksLock};
+	VideoSinks.Emplace(VideoTrack.TrackID, std::make_shared<FVideoSink>(VideoTrack.TrackID, VideoAtlas));
+	VideoSinks[VideoTrack.TrackID]->SetConversionMode(VideoConversionMode);
+	VideoSinks[VideoTrack.TrackID]->SetParallelConversion(bIsParallelVideoConversionEnabled);
+	// Sinks of tracks which do not come from the SDK are fed by whoever added them
+	if (bIsFromSdk)
+	{
+		Sdk->video()
+		    .remote()
+		    .set_video_sink(Track, VideoSinks[VideoTrack.TrackID])
+		    .on_error(DLB_ERROR_HANDLER_NO_DELEGATE);
+	}
+
+	FScopeLock Lock2{&RemoteParticipantsLock};
+	if (RemoteParticipants.Contains(VideoTrack.ParticipantID))
+	{
+		VideoSinks[VideoTrack.TrackID]->OnTextureCreated(
+		    [this, VideoTrack] { ProcessVideoTrackTextureCreated(VideoTrack); });
+	}
+	else
+	{
+		DLB_UE_LOG("Buffering video track added: TrackID=%s ParticipantID=%s", *VideoTrack.TrackID,
+		           *VideoTrack.ParticipantID);
+		BufferedAddedVideoTracks.FindOrAdd(VideoTrack.ParticipantID).Add(VideoTrack);
+	}
+}
+
+void UDolbyIOSubsystem::Handle(const remote_video_track_removed& Event)
+{
+	const FDolbyIOVideoTrack VideoTrack = ToFDolbyIOVideoTrack(Event.track);
+	DLB_UE_LOG("Video track removed: TrackID=%s ParticipantID=%s", *VideoTrack.TrackID, *VideoTrack.ParticipantID);
+	WarnIfVideoTrackSuspicious(VideoTrack.TrackID);
+
+	FScopeLock Lock{&VideoSinksLock};
+	if (std::shared_ptr<DolbyIO::FVideoSink>* Sink = VideoSinks.Find(VideoTrack.TrackID))
+	{
+		(*Sink)->UnbindAllMaterials();
+		VideoSinks.Remove(VideoTrack.TrackID);
+	}
+	else
+	{
+		DLB_UE_LOG_BASE(Warning, "Non-existent video track removed");
+	}
+
+	BroadcastEvent(*this, OnVideoTrackRemoved, VideoTrack);
+}
+
+void UDolbyIOSubsystem::Handle(const utils::vfs_event& Event)
+{
+	for (const auto& TrackMapItem : Event.new_enabled)
+	{
+		const FDolbyIOVideoTrack VideoTrack = ToFDolbyIOVideoTrack(TrackMapItem);
+
+		// Checked under the lock so that a texture created meanwhile finds the track buffered
+		FScopeLock Lock{&VideoSinksLock};
+		if (GetTexture(VideoTrack.TrackID))
+		{
+			BroadcastVideoTrackEnabled(VideoTrack);
+		}
+		else
+		{
+			DLB_UE_LOG("Buffering video track enabled: TrackID=%s ParticipantID=%s", *VideoTrack.TrackID,
+			           *VideoTrack.ParticipantID);
+			BufferedEnabledVideoTracks.FindOrAdd(VideoTrack.ParticipantID).Add(VideoTrack);
+		}
+	}
+	for (const auto& TrackMapItem : Event.new_disabled)
+	{
+		const FDolbyIOVideoTrack VideoTrack = ToFDolbyIOVideoTrack(TrackMapItem);
+		DLB_UE_LOG("Video track ID %s for participant ID %s disabled", *VideoTrack.TrackID, *VideoTrack.ParticipantID);
+		BroadcastEvent(*this, OnVideoTrackDisabled, VideoTrack);
+	}
+}
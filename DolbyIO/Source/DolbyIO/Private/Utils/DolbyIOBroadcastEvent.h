@@ -0,0 +1,51 @@
+// Copyright 2023 Dolby Laboratories
+
+#pragma once
+
+#include "Utils/DolbyIOEventQueue.h"
+#include "Utils/DolbyIOLLM.h"
+#include "Utils/DolbyIOStats.h"
+#include "Utils/DolbyIOTrace.h"
+
+namespace DolbyIO
+{
+	/** Broadcasts the subsystem's event on the game thread during the next drain of its event queue. The arguments are
+	 * copied, the event itself is not, so it must be a member of the subsystem. */
+	template <class TDelegate, class... TArgs>
+	void BroadcastEvent(const UDolbyIOSubsystem& Subsystem, TDelegate& Event, TArgs&&... Args)
+	{
+		LLM_SCOPE_BYTAG(DolbyIO_Events);
+		FEventQueue::Get(Subsystem).Push(
+		    [&Event, Args...]
+		    {
+			    DLB_TRACE_SCOPE(BroadcastEvent);
+			    SCOPE_CYCLE_COUNTER(STAT_DolbyIO_BroadcastEvent);
+			    Event.Broadcast(Args...);
+		    });
+	}
+
+	/** Like BroadcastEvent, but if the event is broadcast again with the same key before the queue reaches it, only the
+	 * latest arguments are broadcast. It is broadcast at most once per frame and MinInterval seconds for each key. */
+	template <class TDelegate, class... TArgs>
+	void BroadcastCoalescedEvent(const UDolbyIOSubsystem& Subsystem, const FString& Key, float MinInterval,
+	                             TDelegate& Event, TArgs&&... Args)
+	{
+		LLM_SCOPE_BYTAG(DolbyIO_Events);
+		FEventQueue::Get(Subsystem).PushCoalesced(
+		    FEventQueue::FCoalescingKey{&Event, Key}, MinInterval,
+		    [&Event, Args...]
+		    {
+			    DLB_TRACE_SCOPE(BroadcastEvent);
+			    SCOPE_CYCLE_COUNTER(STAT_DolbyIO_BroadcastEvent);
+			    Event.Broadcast(Args...);
+		    });
+	}
+
+	/** Drops the coalesced event broadcast with the key which did not run yet, for example before broadcasting a newer
+	 * one with BroadcastEvent which must not be delayed behind other events. */
+	template <class TDelegate>
+	void DiscardCoalescedEvent(const UDolbyIOSubsystem& Subsystem, const FString& Key, TDelegate& Event)
+	{
+		FEventQueue::Get(Subsystem).DiscardCoalesced(FEventQueue::FCoalescingKey{&Event, Key});
+	}
+}
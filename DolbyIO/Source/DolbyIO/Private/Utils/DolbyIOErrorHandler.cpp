@@ -106,13 +106,14 @@ namespace DolbyIO
 		                *ToString(DolbyIOSubsystem.ConferenceStatus), *File, Line);
 		if (OnError)
 		{
-			BroadcastEvent(*OnError, ErrorMsg);
+			BroadcastEvent(DolbyIOSubsystem, *OnError, ErrorMsg);
 		}
 	}
 
-	void FErrorHandler::Warn(const FDolbyIOOnErrorDelegate& OnError, const FString& Msg)
+	void FErrorHandler::Warn(const UDolbyIOSubsystem& DolbyIOSubsystem, const FDolbyIOOnErrorDelegate& OnError,
+	                         const FString& Msg)
 	{
 		DLB_UE_LOG_BASE(Warning, "%s", *Msg);
-		BroadcastEvent(OnError, Msg);
+		BroadcastEvent(DolbyIOSubsystem, OnError, Msg);
 	}
 }
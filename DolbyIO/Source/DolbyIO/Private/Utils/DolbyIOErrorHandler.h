@@ -15,7 +15,7 @@ namespace DolbyIO
 #define DLB_ERROR_HANDLER(OnError) FErrorHandler(__FILE__, __LINE__, GetSubsystem(), OnError)
 #define DLB_ERROR_HANDLER_NO_DELEGATE FErrorHandler(__FILE__, __LINE__, GetSubsystem())
 
-#define DLB_WARNING(OnError, Msg) FErrorHandler::Warn(OnError, Msg)
+#define DLB_WARNING(OnError, Msg) FErrorHandler::Warn(GetSubsystem(), OnError, Msg)
 
 		FErrorHandler(const FString& File, int Line, UDolbyIOSubsystem& DolbyIOSubsystem);
 		FErrorHandler(const FString& File, int Line, UDolbyIOSubsystem& DolbyIOSubsystem,
@@ -24,7 +24,8 @@ namespace DolbyIO
 		void operator()(std::exception_ptr&& ExcPtr) const;
 		void HandleError() const;
 
-		static void Warn(const FDolbyIOOnErrorDelegate& OnError, const FString& Msg);
+		static void Warn(const UDolbyIOSubsystem& DolbyIOSubsystem, const FDolbyIOOnErrorDelegate& OnError,
+		                 const FString& Msg);
 
 	private:
 		void HandleError(TFunction<void()> Callee) const;
@@ -0,0 +1,178 @@
+// Copyright 2023 Dolby Laboratories
+
+#include "Utils/DolbyIOEventQueue.h"
+
+#include "DolbyIO.h"
+#include "Utils/DolbyIOLLM.h"
+#include "Utils/DolbyIOTrace.h"
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CoreGlobals.h"
+
+namespace DolbyIO
+{
+	namespace
+	{
+		TAutoConsoleVariable<int32> CVarMaxEventsPerFrame(
+		    TEXT("DolbyIO.MaxEventsPerFrame"), 512,
+		    TEXT("Maximum number of events broadcast on the game thread per frame, the rest wait for the next ")
+		    TEXT("frames. 0 = unlimited."));
+
+		uint64 GetCapacity(int MinCapacity)
+		{
+			return FMath::RoundUpToPowerOfTwo(static_cast<uint32>(FMath::Max(MinCapacity, 2)));
+		}
+	}
+
+	FEventQueue::FEventQueue(int MinCapacity) : Mask(GetCapacity(MinCapacity) - 1)
+	{
+		LLM_SCOPE_BYTAG(DolbyIO_Events);
+		Slots.reset(new FSlot[Mask + 1]);
+		for (uint64 Pos = 0; Pos <= Mask; ++Pos)
+		{
+			Slots[Pos].Sequence.store(Pos, std::memory_order_relaxed);
+		}
+		Overflow.Reserve(Mask + 1);
+		DrainedOverflow.Reserve(Mask + 1);
+
+#if ENGINE_MAJOR_VERSION == 5
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FEventQueue::Tick));
+#else
+		TickerHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FEventQueue::Tick));
+#endif
+	}
+
+	FEventQueue::~FEventQueue()
+	{
+		Shutdown();
+		for (uint64 Pos = DequeuePos;; ++Pos)
+		{
+			FSlot& Slot = Slots[Pos & Mask];
+			if (Slot.Sequence.load(std::memory_order_acquire) != Pos + 1)
+			{
+				break;
+			}
+			Slot.Event.Destroy();
+		}
+	}
+
+	FEventQueue& FEventQueue::Get(const UDolbyIOSubsystem& Subsystem)
+	{
+		return *Subsystem.EventQueue;
+	}
+
+	void FEventQueue::Shutdown()
+	{
+		if (bIsShutdown.exchange(true))
+		{
+			return;
+		}
+#if ENGINE_MAJOR_VERSION == 5
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+#else
+		FTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+#endif
+	}
+
+	int FEventQueue::Drain(int MaxEvents)
+	{
+		int Ran = 0;
+		while ((MaxEvents <= 0 || Ran < MaxEvents) && !bIsShutdown.load(std::memory_order_relaxed))
+		{
+			// Events pushed before the ring filled up run before those which overflowed
+			if (!RunFromRing() && !RunFromOverflow())
+			{
+				break;
+			}
+			++Ran;
+		}
+		return Ran;
+	}
+
+	bool FEventQueue::Tick(float DeltaTime)
+	{
+		DLB_TRACE_SCOPE(DrainEvents);
+		if (DeferredEvents.Num())
+		{
+			const TArray<TPair<FCoalescingKey, uint64>> Events = MoveTemp(DeferredEvents);
+			for (const TPair<FCoalescingKey, uint64>& Event : Events)
+			{
+				RunCoalesced(Event.Key, Event.Value);
+			}
+		}
+		Drain(CVarMaxEventsPerFrame.GetValueOnGameThread());
+		return true;
+	}
+
+	void FEventQueue::DiscardCoalesced(const FCoalescingKey& Key)
+	{
+		FScopeLock Lock{&CoalescedLock};
+		CoalescedEvents.Remove(Key);
+	}
+
+	void FEventQueue::RunCoalesced(const FCoalescingKey& Key, uint64 Ticket)
+	{
+		TUniqueFunction<void()> Callable;
+		{
+			FScopeLock Lock{&CoalescedLock};
+			// The event may have been discarded, possibly with the key pushed again since then
+			FCoalesced* Coalesced = CoalescedEvents.Find(Key);
+			if (!Coalesced || !Coalesced->bIsQueued || Coalesced->Ticket != Ticket)
+			{
+				return;
+			}
+			const double Now = FPlatformTime::Seconds();
+			if (Coalesced->LastRunFrame == GFrameCounter || Now - Coalesced->LastRunTime < Coalesced->MinInterval)
+			{
+				DeferredEvents.Emplace(Key, Ticket);
+				return;
+			}
+			Coalesced->LastRunTime = Now;
+			Coalesced->LastRunFrame = GFrameCounter;
+			Coalesced->bIsQueued = false;
+			Callable = MoveTemp(Coalesced->Latest);
+		}
+		Callable();
+	}
+
+	bool FEventQueue::RunFromRing()
+	{
+		FSlot& Slot = Slots[DequeuePos & Mask];
+		if (Slot.Sequence.load(std::memory_order_acquire) != DequeuePos + 1)
+		{
+			return false;
+		}
+		--Count;
+		Slot.Event.Invoke();
+		Slot.Event.Destroy();
+		Slot.Sequence.store(DequeuePos + Mask + 1, std::memory_order_release);
+		++DequeuePos;
+		return true;
+	}
+
+	bool FEventQueue::RunFromOverflow()
+	{
+		if (DrainedOverflowIndex == DrainedOverflow.Num())
+		{
+			if (!bIsOverflowing.load(std::memory_order_acquire))
+			{
+				return false;
+			}
+			DrainedOverflow.Reset();
+			DrainedOverflowIndex = 0;
+
+			FScopeLock Lock{&OverflowLock};
+			if (!Overflow.Num())
+			{
+				bIsOverflowing = false;
+				return false;
+			}
+			Swap(DrainedOverflow, Overflow);
+		}
+		--Count;
+		TUniqueFunction<void()> Event = MoveTemp(DrainedOverflow[DrainedOverflowIndex++]);
+		Event();
+		return true;
+	}
+}
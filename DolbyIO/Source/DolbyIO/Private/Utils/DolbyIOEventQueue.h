@@ -0,0 +1,225 @@
+// Copyright 2023 Dolby Laboratories
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/Map.h"
+#include "Containers/Ticker.h"
+#include "Containers/UnrealString.h"
+#include "HAL/CriticalSection.h"
+#include "Runtime/Launch/Resources/Version.h"
+#include "Templates/Function.h"
+
+#include <atomic>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+class UDolbyIOSubsystem;
+
+namespace DolbyIO
+{
+	/** Multiple-producer single-consumer queue of events to broadcast on the game thread. Events are constructed in
+	 * place in a preallocated ring of slots, so pushing them does not allocate unless their arguments do, and the game
+	 * thread runs them in a single tick per frame, at most DolbyIO.MaxEventsPerFrame of them. Events pushed while the
+	 * ring is full go to an overflow list until the game thread has caught up, so none are dropped. Events pushed with
+	 * PushCoalesced replace the ones with the same key which did not run yet, keeping the position of the first, but
+	 * may be delayed to a later frame than events pushed after them. */
+	class FEventQueue final
+	{
+	public:
+		explicit FEventQueue(int MinCapacity = DefaultCapacity);
+		~FEventQueue();
+
+		static FEventQueue& Get(const UDolbyIOSubsystem& Subsystem);
+
+		// May be called on any thread, events are run in the order in which each thread pushed them
+		template <class TCallable> void Push(TCallable&& Callable)
+		{
+			if (bIsShutdown.load(std::memory_order_relaxed))
+			{
+				return;
+			}
+			++Count;
+			if (bIsOverflowing.load(std::memory_order_acquire) || !TryPushToRing<TCallable>(Callable))
+			{
+				FScopeLock Lock{&OverflowLock};
+				bIsOverflowing = true;
+				Overflow.Emplace(Forward<TCallable>(Callable));
+			}
+		}
+
+		struct FCoalescingKey
+		{
+			const void* Event;
+			FString SubKey;
+
+			bool operator==(const FCoalescingKey& Other) const
+			{
+				return Event == Other.Event && SubKey == Other.SubKey;
+			}
+
+			friend uint32 GetTypeHash(const FCoalescingKey& Key)
+			{
+				return HashCombine(PointerHash(Key.Event), GetTypeHash(Key.SubKey));
+			}
+		};
+
+		/** Runs at most once per frame and MinInterval seconds for each key, only the latest event pushed with the key
+		 * runs. May be called on any thread. */
+		template <class TCallable> void PushCoalesced(FCoalescingKey&& Key, float MinInterval, TCallable&& Callable)
+		{
+			if (bIsShutdown.load(std::memory_order_relaxed))
+			{
+				return;
+			}
+			uint64 Ticket;
+			{
+				FScopeLock Lock{&CoalescedLock};
+				FCoalesced& Coalesced = CoalescedEvents.FindOrAdd(Key);
+				Coalesced.Latest = Forward<TCallable>(Callable);
+				Coalesced.MinInterval = MinInterval;
+				if (Coalesced.bIsQueued)
+				{
+					return;
+				}
+				Coalesced.bIsQueued = true;
+				Ticket = Coalesced.Ticket = ++LastTicket;
+			}
+			Push([this, Key = MoveTemp(Key), Ticket] { RunCoalesced(Key, Ticket); });
+		}
+
+		/** Drops the event pushed with the key which did not run yet, if any, and forgets the key. Used when a newer
+		 * event supersedes it and must not be delayed, or when the key is not used anymore. May be called on any
+		 * thread. */
+		void DiscardCoalesced(const FCoalescingKey& Key);
+
+		// Must be called on the game thread, pending events are discarded and events pushed from now on are ignored
+		void Shutdown();
+		/** Runs up to MaxEvents pending events, all of them if MaxEvents is not positive, and returns how many ran. */
+		int Drain(int MaxEvents);
+
+		/** Returns the number of events waiting to be run. */
+		int64 Num() const
+		{
+			return Count.load(std::memory_order_relaxed);
+		}
+
+		static constexpr int DefaultCapacity = 1024;
+
+	private:
+		class FEvent final
+		{
+		public:
+			static constexpr SIZE_T InlineSize = 192;
+			static constexpr SIZE_T InlineAlignment = 16;
+
+			template <class TCallable> void Emplace(TCallable&& Callable)
+			{
+				using FCallable = std::decay_t<TCallable>;
+				if constexpr (sizeof(FCallable) <= InlineSize && alignof(FCallable) <= InlineAlignment)
+				{
+					new (Storage) FCallable(Forward<TCallable>(Callable));
+					InvokeFn = [](void* Ptr) { (*static_cast<FCallable*>(Ptr))(); };
+					DestroyFn = [](void* Ptr) { static_cast<FCallable*>(Ptr)->~FCallable(); };
+				}
+				else
+				{
+					Emplace(TUniqueFunction<void()>{Forward<TCallable>(Callable)});
+				}
+			}
+
+			void Invoke()
+			{
+				InvokeFn(Storage);
+			}
+
+			void Destroy()
+			{
+				DestroyFn(Storage);
+			}
+
+		private:
+			alignas(InlineAlignment) uint8 Storage[InlineSize];
+			void (*InvokeFn)(void*) = nullptr;
+			void (*DestroyFn)(void*) = nullptr;
+		};
+
+		struct FSlot
+		{
+			std::atomic<uint64> Sequence;
+			FEvent Event;
+		};
+
+		template <class TCallable> bool TryPushToRing(TCallable& Callable)
+		{
+			uint64 Pos = EnqueuePos.load(std::memory_order_relaxed);
+			FSlot* Slot;
+			for (;;)
+			{
+				Slot = &Slots[Pos & Mask];
+				const int64 Diff =
+				    static_cast<int64>(Slot->Sequence.load(std::memory_order_acquire)) - static_cast<int64>(Pos);
+				if (Diff == 0)
+				{
+					if (EnqueuePos.compare_exchange_weak(Pos, Pos + 1, std::memory_order_relaxed))
+					{
+						break;
+					}
+				}
+				else if (Diff < 0)
+				{
+					return false;
+				}
+				else
+				{
+					Pos = EnqueuePos.load(std::memory_order_relaxed);
+				}
+			}
+			Slot->Event.Emplace(Forward<TCallable>(Callable));
+			Slot->Sequence.store(Pos + 1, std::memory_order_release);
+			return true;
+		}
+
+		struct FCoalesced
+		{
+			TUniqueFunction<void()> Latest;
+			float MinInterval = 0.0f;
+			double LastRunTime = 0.0;
+			uint64 LastRunFrame = 0;
+			// Identifies the queued event, so that it is not run by an event queued for the key before it was discarded
+			uint64 Ticket = 0;
+			bool bIsQueued = false;
+		};
+
+		bool Tick(float DeltaTime);
+		void RunCoalesced(const FCoalescingKey& Key, uint64 Ticket);
+		bool RunFromRing();
+		bool RunFromOverflow();
+
+		std::unique_ptr<FSlot[]> Slots;
+		const uint64 Mask;
+		std::atomic<uint64> EnqueuePos{0};
+		std::atomic<int64> Count{0};
+		std::atomic<bool> bIsOverflowing{false};
+		std::atomic<bool> bIsShutdown{false};
+
+		TArray<TUniqueFunction<void()>> Overflow;
+		FCriticalSection OverflowLock;
+
+		TMap<FCoalescingKey, FCoalesced> CoalescedEvents;
+		FCriticalSection CoalescedLock;
+		uint64 LastTicket = 0;
+
+		// Only accessed on the game thread
+		uint64 DequeuePos = 0;
+		TArray<TUniqueFunction<void()>> DrainedOverflow;
+		int DrainedOverflowIndex = 0;
+		TArray<TPair<FCoalescingKey, uint64>> DeferredEvents;
+#if ENGINE_MAJOR_VERSION == 5
+		FTSTicker::FDelegateHandle TickerHandle;
+#else
+		FDelegateHandle TickerHandle;
+#endif
+	};
+}
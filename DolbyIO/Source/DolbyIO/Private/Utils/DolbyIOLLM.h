@@ -0,0 +1,12 @@
+// Copyright 2023 Dolby Laboratories
+
+#pragma once
+
+#include "HAL/LowLevelMemTracker.h"
+
+// Reported together as DolbyIO by "stat llm", separately in LLM reports and Unreal Insights
+LLM_DECLARE_TAG(DolbyIO);
+LLM_DECLARE_TAG(DolbyIO_Sdk);
+LLM_DECLARE_TAG(DolbyIO_Video);
+LLM_DECLARE_TAG(DolbyIO_Participants);
+LLM_DECLARE_TAG(DolbyIO_Events);
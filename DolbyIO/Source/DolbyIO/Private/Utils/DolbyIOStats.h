@@ -0,0 +1,38 @@
+// Copyright 2023 Dolby Laboratories
+
+#pragma once
+
+#include "Stats/Stats.h"
+
+#include <atomic>
+
+// Shown by "stat dolbyio"
+DECLARE_STATS_GROUP(TEXT("Dolby.io"), STATGROUP_DolbyIO, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Handle SDK event"), STAT_DolbyIO_HandleEvent, STATGROUP_DolbyIO, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Broadcast event"), STAT_DolbyIO_BroadcastEvent, STATGROUP_DolbyIO, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Convert video frame"), STAT_DolbyIO_ConvertFrame, STATGROUP_DolbyIO, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Upload video frame"), STAT_DolbyIO_UploadFrame, STATGROUP_DolbyIO, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Update spatial audio"), STAT_DolbyIO_SpatialUpdate, STATGROUP_DolbyIO, );
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Suppressed listener updates"), STAT_DolbyIO_SuppressedListenerUpdates,
+                                      STATGROUP_DolbyIO, );
+
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Video frame buffers"), STAT_DolbyIO_VideoBufferMemory, STATGROUP_DolbyIO, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Video textures"), STAT_DolbyIO_VideoTextureMemory, STATGROUP_DolbyIO, );
+
+namespace DolbyIO
+{
+	// Totals of the memory stats, also kept when stats are not collected so that tests can read them
+	extern std::atomic<int64> VideoBufferMemory;
+	extern std::atomic<int64> VideoTextureMemory;
+}
+
+// Amounts may be negative
+#define DLB_INC_MEMORY_STAT_BY(Stat, Amount)                 \
+	{                                                        \
+		const int64 DLB_Amount = (Amount);                   \
+		INC_MEMORY_STAT_BY(STAT_DolbyIO_##Stat, DLB_Amount); \
+		DolbyIO::Stat += DLB_Amount;                         \
+	}
+#define DLB_DEC_MEMORY_STAT_BY(Stat, Amount) DLB_INC_MEMORY_STAT_BY(Stat, -(Amount))
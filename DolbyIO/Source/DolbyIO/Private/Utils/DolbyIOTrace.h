@@ -0,0 +1,16 @@
+// Copyright 2023 Dolby Laboratories
+
+#pragma once
+
+#include "ProfilingDebugging/CountersTrace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/MiscTrace.h"
+#include "Trace/Trace.h"
+
+UE_TRACE_CHANNEL_EXTERN(DolbyIOChannel);
+
+TRACE_DECLARE_INT_COUNTER_EXTERN(DolbyIOActiveSinks);
+TRACE_DECLARE_INT_COUNTER_EXTERN(DolbyIOFramesInFlight);
+TRACE_DECLARE_INT_COUNTER_EXTERN(DolbyIOBytesUploaded);
+
+#define DLB_TRACE_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR("DolbyIO::" #Name, DolbyIOChannel)
@@ -0,0 +1,48 @@
+// Copyright 2023 Dolby Laboratories
+
+#pragma once
+
+#include <atomic>
+
+namespace DolbyIO
+{
+	/** Single-producer single-consumer mailbox which never blocks either side. The writer and the reader each own
+	 * one slot and exchange it with the spare slot, so the reader always gets the newest published value and values
+	 * published in the meantime are overwritten. */
+	template <typename T> class TTripleBuffer final
+	{
+	public:
+		T& GetWriteSlot()
+		{
+			return Slots[WriteIndex];
+		}
+
+		/** Returns true if the previously published value was overwritten before being acquired. */
+		bool Publish()
+		{
+			const int Previous = Spare.exchange(WriteIndex | FreshBit, std::memory_order_acq_rel);
+			WriteIndex = Previous & IndexMask;
+			return (Previous & FreshBit) != 0;
+		}
+
+		/** Returns the newest published value or nullptr if nothing was published since the previous call. */
+		T* Acquire()
+		{
+			if (!(Spare.load(std::memory_order_relaxed) & FreshBit))
+			{
+				return nullptr;
+			}
+			ReadIndex = Spare.exchange(ReadIndex, std::memory_order_acq_rel) & IndexMask;
+			return &Slots[ReadIndex];
+		}
+
+	private:
+		static constexpr int IndexMask = 3;
+		static constexpr int FreshBit = 4;
+
+		T Slots[3];
+		int WriteIndex = 0;
+		int ReadIndex = 1;
+		std::atomic<int> Spare{2};
+	};
+}
@@ -0,0 +1,142 @@
+// Copyright 2023 Dolby Laboratories
+
+#include "DolbyIOVideoAtlas.h"
+
+#include "DolbyIOVideoRHI.h"
+#include "Utils/DolbyIOLogging.h"
+#include "Utils/DolbyIOStats.h"
+
+#include "Engine/Texture2D.h"
+#include "Materials/MaterialInstance.h"
+#include "RenderingThread.h"
+
+namespace DolbyIO
+{
+	FVideoAtlasPage::FVideoAtlasPage(FIntPoint CellSize)
+	    : Texture(UTexture2D::CreateTransient(1, 1)), CellSize(CellSize)
+	{
+		// The texture's own resource stays 1x1, the page is rendered to a separate RHI texture swapped into it
+		Texture->AddToRoot();
+		Texture->UpdateResource();
+
+		const int NumCells = (Size / CellSize.X) * (Size / CellSize.Y);
+		for (int Cell = NumCells - 1; Cell >= 0; --Cell)
+		{
+			FreeCells.Add(Cell);
+		}
+		DLB_INC_MEMORY_STAT_BY(VideoTextureMemory, Memory);
+	}
+
+	FVideoAtlasPage::~FVideoAtlasPage()
+	{
+		// May run on the rendering thread when a render command holds the last slot of the page
+		DLB_DEC_MEMORY_STAT_BY(VideoTextureMemory, Memory);
+	}
+
+	UTexture2D* FVideoAtlasPage::GetTexture() const
+	{
+		return Texture;
+	}
+
+	FIntPoint FVideoAtlasPage::GetCellSize() const
+	{
+		return CellSize;
+	}
+
+	void FVideoAtlasPage::PrepareRender()
+	{
+		if (bIsTextureRHISwapped.exchange(false))
+		{
+			RecacheMaterialInstanceUniformExpressions(Texture, false);
+		}
+	}
+
+	FRHITexture2D* FVideoAtlasPage::GetTextureRHI()
+	{
+		EnsureTextureRHI(TextureRHI, TEXT("DolbyIOVideoAtlas"), Size, Size, PF_B8G8R8A8,
+		                 TexCreate_ShaderResource | TexCreate_SRGB);
+		if (SwapInTextureRHI(*Texture, TextureRHI))
+		{
+			bIsTextureRHISwapped = true;
+		}
+		return TextureRHI;
+	}
+
+	FVideoAtlas::~FVideoAtlas()
+	{
+		if (!Pages.Num())
+		{
+			return;
+		}
+
+		// Render commands may still use the pages, textures drop their slots when they next prepare a frame
+		FlushRenderingCommands();
+		for (const FPagePtr& Page : Pages)
+		{
+			DLB_UE_LOG("Releasing video atlas page %u", Page->Texture->GetUniqueID());
+			Page->Texture->RemoveFromRoot();
+		}
+	}
+
+	void FVideoAtlas::SetEnabled(bool bEnabled, FIntPoint CellSize)
+	{
+		bIsEnabled = bEnabled;
+		CurrentCellSize = {FMath::Clamp(CellSize.X, 16, FVideoAtlasPage::Size),
+		                   FMath::Clamp(CellSize.Y, 16, FVideoAtlasPage::Size)};
+	}
+
+	bool FVideoAtlas::CanHold(FIntPoint FrameSize) const
+	{
+		return bIsEnabled && FrameSize.X <= CurrentCellSize.X && FrameSize.Y <= CurrentCellSize.Y;
+	}
+
+	bool FVideoAtlas::IsCurrent(const FVideoAtlasSlot& Slot) const
+	{
+		return Slot.Page && Slot.Page->GetCellSize() == CurrentCellSize;
+	}
+
+	FVideoAtlasSlot FVideoAtlas::Allocate()
+	{
+		FPagePtr* Page = Pages.FindByPredicate([this](const FPagePtr& Page)
+		                                       { return Page->CellSize == CurrentCellSize && Page->FreeCells.Num(); });
+		if (!Page)
+		{
+			Page = &Pages.Emplace_GetRef(MakeShared<FVideoAtlasPage, ESPMode::ThreadSafe>(CurrentCellSize));
+			DLB_UE_LOG("Created video atlas page %u with %dx%d cells", (*Page)->Texture->GetUniqueID(),
+			           CurrentCellSize.X, CurrentCellSize.Y);
+		}
+
+		FVideoAtlasSlot Slot;
+		Slot.Page = *Page;
+		Slot.Cell = Slot.Page->FreeCells.Pop(false);
+		const int Columns = FVideoAtlasPage::Size / Slot.Page->CellSize.X;
+		Slot.Offset = {Slot.Cell % Columns * Slot.Page->CellSize.X, Slot.Cell / Columns * Slot.Page->CellSize.Y};
+		return Slot;
+	}
+
+	void FVideoAtlas::Release(FVideoAtlasSlot& Slot)
+	{
+		if (!Slot.Page)
+		{
+			return;
+		}
+
+		Slot.Page->FreeCells.Add(Slot.Cell);
+		if (Slot.Page->FreeCells.Num() == (FVideoAtlasPage::Size / Slot.Page->CellSize.X) *
+		                                      (FVideoAtlasPage::Size / Slot.Page->CellSize.Y))
+		{
+			DLB_UE_LOG("Releasing video atlas page %u", Slot.Page->Texture->GetUniqueID());
+			Slot.Page->Texture->RemoveFromRoot();
+			Pages.Remove(Slot.Page);
+		}
+		Slot = {};
+	}
+
+	FLinearColor FVideoAtlas::GetUVScaleOffset(const FVideoAtlasSlot& Slot, FIntPoint FrameSize)
+	{
+		// Sampling stops at the centers of the frame's outermost texels, the cells have no gutter
+		constexpr float Size = FVideoAtlasPage::Size;
+		return {FMath::Max(FrameSize.X - 1, 0) / Size, FMath::Max(FrameSize.Y - 1, 0) / Size,
+		        (Slot.Offset.X + 0.5f) / Size, (Slot.Offset.Y + 0.5f) / Size};
+	}
+}
@@ -0,0 +1,76 @@
+// Copyright 2023 Dolby Laboratories
+
+#pragma once
+
+#include "RHIResources.h"
+#include "Templates/SharedPointer.h"
+
+#include <atomic>
+
+class UTexture2D;
+
+namespace DolbyIO
+{
+	class FVideoAtlasPage final
+	{
+	public:
+		FVideoAtlasPage(FIntPoint CellSize);
+		~FVideoAtlasPage();
+
+		UTexture2D* GetTexture() const;
+		FIntPoint GetCellSize() const;
+
+		// Must be called on the game thread before rendering the page's slots
+		void PrepareRender();
+		// Must be called on the rendering thread
+		FRHITexture2D* GetTextureRHI();
+
+		static constexpr int Size = 4096;
+		// Counted when the page is created, although its RHI texture is only created when it is first rendered
+		static constexpr int64 Memory = int64{Size} * Size * 4;
+
+	private:
+		friend class FVideoAtlas;
+
+		UTexture2D* const Texture;
+		const FIntPoint CellSize;
+		TArray<int> FreeCells;
+		FTexture2DRHIRef TextureRHI;
+		std::atomic<bool> bIsTextureRHISwapped{false};
+	};
+
+	struct FVideoAtlasSlot
+	{
+		TSharedPtr<FVideoAtlasPage, ESPMode::ThreadSafe> Page;
+		int Cell = INDEX_NONE;
+		FIntPoint Offset{0, 0};
+	};
+
+	/** Packs the frames of many video tracks into a few large textures split into equally sized cells. Owned by the
+	 * subsystem and only accessed on the game thread, except for FVideoAtlasPage::GetTextureRHI. */
+	class FVideoAtlas final
+	{
+	public:
+		~FVideoAtlas();
+
+		void SetEnabled(bool bEnabled, FIntPoint CellSize);
+		bool CanHold(FIntPoint FrameSize) const;
+		/** Returns false for slots allocated before the cell size was changed. */
+		bool IsCurrent(const FVideoAtlasSlot& Slot) const;
+
+		FVideoAtlasSlot Allocate();
+		void Release(FVideoAtlasSlot& Slot);
+
+		/** Returns the scale and offset of the slot's frame in the page's UV space, packed as (ScaleU, ScaleV,
+		 * OffsetU, OffsetV). The frame is inset by half a texel so that bilinear filtering does not bleed the
+		 * neighbouring cells into it. */
+		static FLinearColor GetUVScaleOffset(const FVideoAtlasSlot& Slot, FIntPoint FrameSize);
+
+	private:
+		using FPagePtr = TSharedPtr<FVideoAtlasPage, ESPMode::ThreadSafe>;
+
+		TArray<FPagePtr> Pages;
+		FIntPoint CurrentCellSize{640, 360};
+		bool bIsEnabled = false;
+	};
+}
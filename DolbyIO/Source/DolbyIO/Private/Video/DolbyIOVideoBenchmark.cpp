@@ -0,0 +1,307 @@
+// Copyright 2023 Dolby Laboratories
+
+#if !UE_BUILD_SHIPPING
+
+#include "DolbyIOAllocationCounter.h"
+#include "DolbyIOVideoConversion.h"
+#include "DolbyIOVideoKernels.h"
+#include "DolbyIOVideoShaders.h"
+#include "DolbyIOVideoSink.h"
+#include "Utils/DolbyIOLogging.h"
+
+#include "Dom/JsonObject.h"
+#include "HAL/IConsoleManager.h"
+#include "Interfaces/IPluginManager.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "RenderingThread.h"
+#include "RHI.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace DolbyIO
+{
+	namespace
+	{
+		struct FBenchmarkFrame
+		{
+			FBenchmarkFrame(int Width, int Height) : Width(Width), Height(Height)
+			{
+				const int ChromaWidth = (Width + 1) / 2;
+				const int ChromaHeight = (Height + 1) / 2;
+				FRandomStream Random{Width * Height};
+				auto Fill = [&Random](TArray<uint8>& Plane, int Size)
+				{
+					Plane.SetNumUninitialized(Size);
+					for (uint8& Value : Plane)
+					{
+						Value = static_cast<uint8>(Random.RandHelper(256));
+					}
+				};
+				Fill(Y, Width * Height);
+				Fill(U, ChromaWidth * ChromaHeight);
+				Fill(V, ChromaWidth * ChromaHeight);
+				Fill(UV, ChromaWidth * ChromaHeight * 2);
+				Fill(BGRA, Width * Height * 4);
+				Reference.SetNumUninitialized(Width * Height * 4);
+				Dest.SetNumUninitialized(Width * Height * 4);
+			}
+
+			void Convert(EVideoConverter Converter, bool bIsNV12, TArray<uint8>& Out) const
+			{
+				const int ChromaWidth = (Width + 1) / 2;
+				if (bIsNV12)
+				{
+					ConvertNV12ToBGRA(Converter, Y.GetData(), Width, UV.GetData(), ChromaWidth * 2, Out.GetData(),
+					                  Width * 4, Width, Height);
+				}
+				else
+				{
+					ConvertI420ToBGRA(Converter, Y.GetData(), Width, U.GetData(), ChromaWidth, V.GetData(), ChromaWidth,
+					                  Out.GetData(), Width * 4, Width, Height);
+				}
+			}
+
+			FVideoPlanes GetPlanes(FVideoTexture::EBufferFormat Format) const
+			{
+				const int ChromaWidth = (Width + 1) / 2;
+				FVideoPlanes Ret;
+				Ret.Format = Format;
+				Ret.Width = Width;
+				Ret.Height = Height;
+				switch (Format)
+				{
+					case FVideoTexture::EBufferFormat::BGRA:
+						Ret.Data[0] = BGRA.GetData();
+						Ret.Stride[0] = Width * 4;
+						break;
+					case FVideoTexture::EBufferFormat::I420:
+						Ret.Data[0] = Y.GetData();
+						Ret.Stride[0] = Width;
+						Ret.Data[1] = U.GetData();
+						Ret.Stride[1] = ChromaWidth;
+						Ret.Data[2] = V.GetData();
+						Ret.Stride[2] = ChromaWidth;
+						break;
+					case FVideoTexture::EBufferFormat::NV12:
+						Ret.Data[0] = Y.GetData();
+						Ret.Stride[0] = Width;
+						Ret.Data[1] = UV.GetData();
+						Ret.Stride[1] = ChromaWidth * 2;
+						break;
+				}
+				return Ret;
+			}
+
+			const int Width;
+			const int Height;
+			TArray<uint8> Y;
+			TArray<uint8> U;
+			TArray<uint8> V;
+			TArray<uint8> UV;
+			TArray<uint8> BGRA;
+			TArray<uint8> Reference;
+			TArray<uint8> Dest;
+		};
+
+		void BenchmarkVideoConversion(const TArray<FString>& Args)
+		{
+			const int Iterations = Args.Num() ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 100;
+			DLB_UE_LOG("Benchmarking video conversion, %d iterations per case", Iterations);
+
+			for (const FIntPoint& Size : {FIntPoint{640, 360}, FIntPoint{1280, 720}, FIntPoint{1920, 1080}})
+			{
+				FBenchmarkFrame Frame{Size.X, Size.Y};
+				for (const bool bIsNV12 : {false, true})
+				{
+					Frame.Convert(EVideoConverter::Sdk, bIsNV12, Frame.Reference);
+					double SdkTime = 0.0;
+					for (const EVideoConverter Converter : {EVideoConverter::Sdk, EVideoConverter::Scalar,
+					                                        EVideoConverter::SSE41, EVideoConverter::AVX2,
+					                                        EVideoConverter::NEON})
+					{
+						if (!IsVideoConverterSupported(Converter))
+						{
+							continue;
+						}
+
+						Frame.Convert(Converter, bIsNV12, Frame.Dest);
+						int MaxDifference = 0;
+						for (int i = 0; i < Frame.Dest.Num(); ++i)
+						{
+							MaxDifference = FMath::Max(MaxDifference, FMath::Abs(Frame.Dest[i] - Frame.Reference[i]));
+						}
+
+						const double Start = FPlatformTime::Seconds();
+						for (int i = 0; i < Iterations; ++i)
+						{
+							Frame.Convert(Converter, bIsNV12, Frame.Dest);
+						}
+						const double Time = (FPlatformTime::Seconds() - Start) * 1000.0 / Iterations;
+						if (Converter == EVideoConverter::Sdk)
+						{
+							SdkTime = Time;
+						}
+						DLB_UE_LOG("%dx%d %s %s: %.3f ms/frame, %.2fx SDK, max difference from SDK %d", Size.X, Size.Y,
+						           bIsNV12 ? TEXT("NV12") : TEXT("I420"), ToString(Converter), Time,
+						           Time > 0.0 ? SdkTime / Time : 0.0, MaxDifference);
+					}
+				}
+			}
+		}
+
+		FAutoConsoleCommand BenchmarkVideoConversionCommand(
+		    TEXT("DolbyIO.BenchmarkVideoConversion"),
+		    TEXT("Compares the plugin's video conversion kernels with the SDK's converter on 360p, 720p and 1080p ")
+		    TEXT("frames. Takes the number of iterations per case as an optional argument (default 100)."),
+		    FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkVideoConversion));
+	}
+
+#if WITH_DEV_AUTOMATION_TESTS
+	/** Drives synthetic frames through the same conversion and upload as frames delivered by the SDK, one frame at a
+	 * time, and reports the results as JSON. Allocations are only counted with the -DolbyIOCountAllocations
+	 * switch. */
+	class FVideoPipelineBenchmark final
+	{
+	public:
+		static void Run(int NumFrames, const FString& Path)
+		{
+			DLB_UE_LOG("Benchmarking video pipeline, %d frames per case", NumFrames);
+
+			TArray<TSharedPtr<FJsonValue>> Cases;
+			for (const FIntPoint& Size : {FIntPoint{640, 360}, FIntPoint{1280, 720}, FIntPoint{1920, 1080}})
+			{
+				const FBenchmarkFrame Frame{Size.X, Size.Y};
+				for (const EBufferFormat Format : {EBufferFormat::I420, EBufferFormat::NV12, EBufferFormat::BGRA})
+				{
+					Cases.Add(MakeShared<FJsonValueObject>(RunCase(Frame.GetPlanes(Format), false, NumFrames)));
+					// BGRA frames are uploaded as they are in both modes and the null RHI cannot run compute shaders
+					if (Format != EBufferFormat::BGRA && IsGpuConversionSupported() && !GUsingNullRHI)
+					{
+						Cases.Add(MakeShared<FJsonValueObject>(RunCase(Frame.GetPlanes(Format), true, NumFrames)));
+					}
+				}
+			}
+
+			const TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+			Result->SetStringField(TEXT("plugin_version"),
+			                       IPluginManager::Get().FindPlugin("DolbyIO")->GetDescriptor().VersionName);
+			Result->SetStringField(TEXT("engine_version"), FEngineVersion::Current().ToString());
+			Result->SetStringField(TEXT("platform"), FPlatformProperties::IniPlatformName());
+			Result->SetStringField(TEXT("rhi"), GDynamicRHI ? GDynamicRHI->GetName() : TEXT("None"));
+			Result->SetStringField(TEXT("cpu_converter"), ToString(GetVideoConverter()));
+			Result->SetNumberField(TEXT("frames_per_case"), NumFrames);
+			Result->SetArrayField(TEXT("cases"), Cases);
+
+			FString Json;
+			FJsonSerializer::Serialize(Result, TJsonWriterFactory<>::Create(&Json));
+			DLB_UE_LOG("%s", *Json);
+			if (FFileHelper::SaveStringToFile(Json, *Path))
+			{
+				DLB_UE_LOG("Saved video pipeline benchmark to %s", *Path);
+			}
+			else
+			{
+				DLB_UE_LOG_BASE(Warning, "Failed to save video pipeline benchmark to %s", *Path);
+			}
+		}
+
+	private:
+		using EBufferFormat = FVideoTexture::EBufferFormat;
+
+		static TSharedRef<FJsonObject> RunCase(const FVideoPlanes& Planes, bool bConvertOnGpu, int NumFrames)
+		{
+			const std::shared_ptr<FVideoSink> Sink = std::make_shared<FVideoSink>(TEXT("Benchmark"));
+			Sink->SetConversionMode(bConvertOnGpu ? EDolbyIOVideoConversionMode::GPU
+			                                      : EDolbyIOVideoConversionMode::CPU);
+			FVideoTexture& Texture = *Sink->Texture;
+
+			// Renders on the rendering thread and waits for it, returns the time spent rendering
+			auto Render = [&Texture]
+			{
+				if (!Texture.PrepareRender())
+				{
+					return 0.0;
+				}
+				double Time = 0.0;
+				ENQUEUE_RENDER_COMMAND(DolbyIOBenchmarkVideoPipeline)
+				(
+				    [&Texture, &Time, Slot = Texture.GetAtlasSlot()](FRHICommandListImmediate& RHICmdList)
+				    {
+					    FAllocationCounter::FScope CountingScope;
+					    const double Start = FPlatformTime::Seconds();
+					    Texture.RenderRHI(RHICmdList, Slot);
+					    Time = FPlatformTime::Seconds() - Start;
+				    });
+				FlushRenderingCommands();
+				return Time;
+			};
+
+			// The first frame creates the buffers and textures, which are then reused
+			Sink->ConvertPlanes(Planes, FPlatformTime::Seconds());
+			Texture.CreateTexture();
+			Render();
+
+			double ConvertTime = 0.0;
+			double RenderTime = 0.0;
+			const int64 Allocations = FAllocationCounter::Get();
+			for (int i = 0; i < NumFrames; ++i)
+			{
+				const double Start = FPlatformTime::Seconds();
+				{
+					FAllocationCounter::FScope CountingScope;
+					Sink->ConvertPlanes(Planes, Start);
+				}
+				ConvertTime += FPlatformTime::Seconds() - Start;
+				RenderTime += Render();
+			}
+
+			const double FrameTime = (ConvertTime + RenderTime) / NumFrames;
+			const double AllocationsPerFrame = static_cast<double>(FAllocationCounter::Get() - Allocations) / NumFrames;
+			const TCHAR* FormatName = Planes.Format == EBufferFormat::BGRA   ? TEXT("ARGB")
+			                          : Planes.Format == EBufferFormat::I420 ? TEXT("I420")
+			                                                                 : TEXT("NV12");
+			const TSharedRef<FJsonObject> Ret = MakeShared<FJsonObject>();
+			Ret->SetStringField(TEXT("format"), FormatName);
+			Ret->SetNumberField(TEXT("width"), Planes.Width);
+			Ret->SetNumberField(TEXT("height"), Planes.Height);
+			Ret->SetStringField(TEXT("conversion"), bConvertOnGpu ? TEXT("GPU") : TEXT("CPU"));
+			Ret->SetNumberField(TEXT("frames_per_second"), FrameTime > 0.0 ? 1.0 / FrameTime : 0.0);
+			Ret->SetNumberField(TEXT("ns_per_pixel"), FrameTime * 1e9 / (Planes.Width * Planes.Height));
+			Ret->SetNumberField(TEXT("convert_ms_per_frame"), ConvertTime * 1000.0 / NumFrames);
+			Ret->SetNumberField(TEXT("render_ms_per_frame"), RenderTime * 1000.0 / NumFrames);
+			if (FAllocationCounter::IsAvailable())
+			{
+				Ret->SetNumberField(TEXT("allocations_per_frame"), AllocationsPerFrame);
+			}
+			else
+			{
+				Ret->SetField(TEXT("allocations_per_frame"), MakeShared<FJsonValueNull>());
+			}
+			DLB_UE_LOG("%dx%d %s %s: %.1f frames/s, %.2f ns/pixel, %.2f allocations/frame", Planes.Width, Planes.Height,
+			           FormatName, bConvertOnGpu ? TEXT("GPU") : TEXT("CPU"), FrameTime > 0.0 ? 1.0 / FrameTime : 0.0,
+			           FrameTime * 1e9 / (Planes.Width * Planes.Height), AllocationsPerFrame);
+			return Ret;
+		}
+	};
+
+	// Flagged as a performance test, saves the results to Saved/Profiling/DolbyIO
+	IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDolbyIOVideoPipelineBenchmark, "DolbyIO.VideoPipelineBenchmark",
+	                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter);
+
+	bool FDolbyIOVideoPipelineBenchmark::RunTest(const FString& Parameters)
+	{
+		if (!FAllocationCounter::IsAvailable())
+		{
+			AddInfo(TEXT("Allocations are not counted, pass -DolbyIOCountAllocations to count them"));
+		}
+		FVideoPipelineBenchmark::Run(
+		    100, FPaths::Combine(FPaths::ProfilingDir(), TEXT("DolbyIO"), TEXT("VideoPipelineBenchmark.json")));
+		return true;
+	}
+#endif
+}
+
+#endif
@@ -0,0 +1,182 @@
+// Copyright 2023 Dolby Laboratories
+
+#include "DolbyIOVideoConversion.h"
+
+#include "DolbyIOVideoKernels.h"
+
+#include "HAL/IConsoleManager.h"
+
+namespace DolbyIO
+{
+	using EBufferFormat = FVideoTexture::EBufferFormat;
+
+	namespace
+	{
+		TAutoConsoleVariable<int32> CVarVideoConverter(
+		    TEXT("DolbyIO.VideoConverter"), -1,
+		    TEXT("Converter used for video frames converted on the CPU: -1 = fastest supported (default), 0 = SDK, ")
+		    TEXT("1 = scalar, 2 = SSE4.1, 3 = AVX2, 4 = NEON."));
+	}
+
+	EVideoConverter GetVideoConverter()
+	{
+		static const EVideoConverter BestConverter = GetBestVideoConverter();
+		const int32 Value = CVarVideoConverter.GetValueOnAnyThread();
+		if (Value < 0 || Value > static_cast<int32>(EVideoConverter::NEON))
+		{
+			return BestConverter;
+		}
+		const EVideoConverter Converter = static_cast<EVideoConverter>(Value);
+		return IsVideoConverterSupported(Converter) ? Converter : BestConverter;
+	}
+
+	FVideoPlanes FVideoPlanes::FromPacked(const uint8* Buffer, EBufferFormat Format, int Width, int Height)
+	{
+		FVideoPlanes Ret;
+		Ret.Format = Format;
+		Ret.Width = Width;
+		Ret.Height = Height;
+		Ret.Data[0] = Buffer;
+		if (Format == EBufferFormat::BGRA)
+		{
+			Ret.Stride[0] = Width * FVideoTexture::Stride;
+			return Ret;
+		}
+
+		const FIntPoint ChromaSize = FVideoTexture::GetChromaSize(Width, Height);
+		Ret.Stride[0] = Width;
+		Ret.Data[1] = Buffer + Width * Height;
+		if (Format == EBufferFormat::NV12)
+		{
+			Ret.Stride[1] = ChromaSize.X * 2;
+		}
+		else
+		{
+			Ret.Stride[1] = Ret.Stride[2] = ChromaSize.X;
+			Ret.Data[2] = Ret.Data[1] + ChromaSize.X * ChromaSize.Y;
+		}
+		return Ret;
+	}
+
+	void CopyPlane(const uint8* Src, int SrcStride, uint8* Dest, int DestStride, int RowSize, int Height)
+	{
+		if (SrcStride == RowSize && DestStride == RowSize)
+		{
+			FMemory::Memcpy(Dest, Src, RowSize * Height);
+			return;
+		}
+		for (int Row = 0; Row < Height; ++Row, Src += SrcStride, Dest += DestStride)
+		{
+			FMemory::Memcpy(Dest, Src, RowSize);
+		}
+	}
+
+	namespace
+	{
+		// Source pixels [Spans[i], Spans[i + 1]) are averaged into destination pixel i
+		void GetSpans(TArray<int>& Spans, int SrcSize, int DestSize)
+		{
+			Spans.SetNumUninitialized(DestSize + 1);
+			for (int i = 0; i <= DestSize; ++i)
+			{
+				Spans[i] = static_cast<int>(static_cast<int64>(i) * SrcSize / DestSize);
+			}
+			// Never leave a destination pixel without a source pixel when upscaling
+			for (int i = 0; i < DestSize; ++i)
+			{
+				Spans[i + 1] = FMath::Max(Spans[i + 1], FMath::Min(Spans[i] + 1, SrcSize));
+				Spans[i] = FMath::Min(Spans[i], SrcSize - 1);
+			}
+		}
+	}
+
+	void ScalePlane(const uint8* Src, int SrcStride, int SrcWidth, int SrcHeight, uint8* Dest, int DestStride,
+	                int DestWidth, int DestHeight, int BytesPerPixel)
+	{
+		if (SrcWidth == DestWidth && SrcHeight == DestHeight)
+		{
+			return CopyPlane(Src, SrcStride, Dest, DestStride, DestWidth * BytesPerPixel, DestHeight);
+		}
+
+		TArray<int> Columns;
+		TArray<int> Rows;
+		GetSpans(Columns, SrcWidth, DestWidth);
+		GetSpans(Rows, SrcHeight, DestHeight);
+
+		for (int Y = 0; Y < DestHeight; ++Y, Dest += DestStride)
+		{
+			const uint8* SrcRows = Src + Rows[Y] * SrcStride;
+			const int NumRows = Rows[Y + 1] - Rows[Y];
+			uint8* DestPixel = Dest;
+			for (int X = 0; X < DestWidth; ++X)
+			{
+				const int NumColumns = Columns[X + 1] - Columns[X];
+				const int Count = NumRows * NumColumns;
+				for (int Channel = 0; Channel < BytesPerPixel; ++Channel)
+				{
+					const uint8* SrcPixel = SrcRows + Columns[X] * BytesPerPixel + Channel;
+					uint32 Sum = 0;
+					for (int Row = 0; Row < NumRows; ++Row, SrcPixel += SrcStride)
+					{
+						for (int Column = 0; Column < NumColumns; ++Column)
+						{
+							Sum += SrcPixel[Column * BytesPerPixel];
+						}
+					}
+					*DestPixel++ = static_cast<uint8>((Sum + Count / 2) / Count);
+				}
+			}
+		}
+	}
+
+	void PackPlanes(const FVideoPlanes& Planes, uint8* Dest, int DestWidth, int DestHeight)
+	{
+		const FVideoPlanes DestPlanes = FVideoPlanes::FromPacked(Dest, Planes.Format, DestWidth, DestHeight);
+		auto Scale = [&](int Plane, FIntPoint SrcSize, FIntPoint DestSize, int BytesPerPixel)
+		{
+			ScalePlane(Planes.Data[Plane], Planes.Stride[Plane], SrcSize.X, SrcSize.Y,
+			           const_cast<uint8*>(DestPlanes.Data[Plane]), DestPlanes.Stride[Plane], DestSize.X, DestSize.Y,
+			           BytesPerPixel);
+		};
+
+		const FIntPoint SrcSize{Planes.Width, Planes.Height};
+		const FIntPoint DestSize{DestWidth, DestHeight};
+		if (Planes.Format == EBufferFormat::BGRA)
+		{
+			return Scale(0, SrcSize, DestSize, FVideoTexture::Stride);
+		}
+
+		const FIntPoint SrcChromaSize = FVideoTexture::GetChromaSize(Planes.Width, Planes.Height);
+		const FIntPoint DestChromaSize = FVideoTexture::GetChromaSize(DestWidth, DestHeight);
+		Scale(0, SrcSize, DestSize, 1);
+		if (Planes.Format == EBufferFormat::NV12)
+		{
+			Scale(1, SrcChromaSize, DestChromaSize, 2);
+		}
+		else
+		{
+			Scale(1, SrcChromaSize, DestChromaSize, 1);
+			Scale(2, SrcChromaSize, DestChromaSize, 1);
+		}
+	}
+
+	void ConvertToBGRA(const FVideoPlanes& Planes, uint8* Dest, int DestStride)
+	{
+		switch (Planes.Format)
+		{
+			case EBufferFormat::BGRA:
+				CopyPlane(Planes.Data[0], Planes.Stride[0], Dest, DestStride, Planes.Width * FVideoTexture::Stride,
+				          Planes.Height);
+				break;
+			case EBufferFormat::I420:
+				ConvertI420ToBGRA(GetVideoConverter(), Planes.Data[0], Planes.Stride[0], Planes.Data[1],
+				                  Planes.Stride[1], Planes.Data[2], Planes.Stride[2], Dest, DestStride, Planes.Width,
+				                  Planes.Height);
+				break;
+			case EBufferFormat::NV12:
+				ConvertNV12ToBGRA(GetVideoConverter(), Planes.Data[0], Planes.Stride[0], Planes.Data[1],
+				                  Planes.Stride[1], Dest, DestStride, Planes.Width, Planes.Height);
+				break;
+		}
+	}
+}
@@ -0,0 +1,39 @@
+// Copyright 2023 Dolby Laboratories
+
+#pragma once
+
+#include "Video/DolbyIOVideoKernels.h"
+#include "Video/DolbyIOVideoTexture.h"
+
+namespace DolbyIO
+{
+	/** Non-owning view of the planes of a video frame. BGRA frames use a single plane, I420 frames use Y, U and V
+	 * planes and NV12 frames use Y and interleaved UV planes. Chroma planes have half the size of the frame rounded
+	 * up. */
+	struct FVideoPlanes
+	{
+		FVideoTexture::EBufferFormat Format = FVideoTexture::EBufferFormat::BGRA;
+		int Width = 0;
+		int Height = 0;
+		const uint8* Data[3] = {};
+		int Stride[3] = {};
+
+		/** Views a tightly packed buffer as laid out by PackPlanes. */
+		static FVideoPlanes FromPacked(const uint8* Buffer, FVideoTexture::EBufferFormat Format, int Width, int Height);
+	};
+
+	void CopyPlane(const uint8* Src, int SrcStride, uint8* Dest, int DestStride, int RowSize, int Height);
+
+	/** Box-filters a plane to the destination size, copies it if the size is the same. */
+	void ScalePlane(const uint8* Src, int SrcStride, int SrcWidth, int SrcHeight, uint8* Dest, int DestStride,
+	                int DestWidth, int DestHeight, int BytesPerPixel);
+
+	/** Copies or downscales all planes one after another into a buffer of FVideoTexture::GetBufferSize bytes. */
+	void PackPlanes(const FVideoPlanes& Planes, uint8* Dest, int DestWidth, int DestHeight);
+
+	/** Returns the converter selected by the DolbyIO.VideoConverter console variable. */
+	EVideoConverter GetVideoConverter();
+
+	/** Converts the frame to BGRA without changing its size. */
+	void ConvertToBGRA(const FVideoPlanes& Planes, uint8* Dest, int DestStride);
+}
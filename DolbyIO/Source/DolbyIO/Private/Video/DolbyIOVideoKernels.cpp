@@ -0,0 +1,364 @@
+// Copyright 2023 Dolby Laboratories
+
+#include "DolbyIOVideoKernels.h"
+
+#include "Utils/DolbyIOCppSdk.h"
+
+#include <dolbyio/comms/media_engine/video_utils.h>
+
+#if PLATFORM_CPU_X86_FAMILY
+#define DLB_VIDEO_KERNELS_X86 1
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define DLB_TARGET(Target)
+#else
+#define DLB_TARGET(Target) __attribute__((target(Target)))
+#endif
+#include <immintrin.h>
+#elif PLATFORM_CPU_ARM_FAMILY && (defined(__aarch64__) || defined(_M_ARM64))
+#define DLB_VIDEO_KERNELS_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace DolbyIO
+{
+	namespace
+	{
+		// All kernels use the same 6-bit fixed point coefficients, so they produce identical output:
+		// B = 1.164 (Y - 16) + 2.018 (U - 128)
+		// G = 1.164 (Y - 16) - 0.391 (U - 128) - 0.813 (V - 128)
+		// R = 1.164 (Y - 16) + 1.596 (V - 128)
+		constexpr int16 KY = 74;
+		constexpr int16 KUB = 129;
+		constexpr int16 KUG = 25;
+		constexpr int16 KVG = 52;
+		constexpr int16 KVR = 102;
+
+		using FConvertRow = void (*)(const uint8* SrcY, const uint8* SrcU, const uint8* SrcV, uint8* Dest, int Width);
+
+		FORCEINLINE uint8 Clamp(int Value)
+		{
+			return static_cast<uint8>(FMath::Clamp(Value, 0, 255));
+		}
+
+		// For NV12, SrcU points to the interleaved UV row and SrcV is unused
+		template <bool bIsNV12>
+		void ConvertRowFrom(const uint8* SrcY, const uint8* SrcU, const uint8* SrcV, uint8* Dest, int Width, int X)
+		{
+			for (; X < Width; ++X)
+			{
+				const int Chroma = X / 2;
+				const int C = (SrcY[X] - 16) * KY;
+				const int D = (bIsNV12 ? SrcU[Chroma * 2] : SrcU[Chroma]) - 128;
+				const int E = (bIsNV12 ? SrcU[Chroma * 2 + 1] : SrcV[Chroma]) - 128;
+				uint8* Pixel = Dest + X * 4;
+				Pixel[0] = Clamp((C + D * KUB + 32) >> 6);
+				Pixel[1] = Clamp((C - D * KUG - E * KVG + 32) >> 6);
+				Pixel[2] = Clamp((C + E * KVR + 32) >> 6);
+				Pixel[3] = 255;
+			}
+		}
+
+		template <bool bIsNV12>
+		void ConvertRowScalar(const uint8* SrcY, const uint8* SrcU, const uint8* SrcV, uint8* Dest, int Width)
+		{
+			ConvertRowFrom<bIsNV12>(SrcY, SrcU, SrcV, Dest, Width, 0);
+		}
+
+#if DLB_VIDEO_KERNELS_X86
+		// Sums saturate only where the result is clamped to 255 anyway, which keeps the output identical to the scalar
+		// kernel
+		template <bool bIsNV12>
+		DLB_TARGET("sse4.1")
+		void ConvertRowSSE41(const uint8* SrcY, const uint8* SrcU, const uint8* SrcV, uint8* Dest, int Width)
+		{
+			const __m128i Bias = _mm_set1_epi16(16);
+			const __m128i ChromaBias = _mm_set1_epi16(128);
+			const __m128i Round = _mm_set1_epi16(32);
+			const __m128i Alpha = _mm_set1_epi8(-1);
+			const __m128i SplitUV = _mm_setr_epi8(0, 2, 4, 6, 1, 3, 5, 7, -1, -1, -1, -1, -1, -1, -1, -1);
+
+			int X = 0;
+			for (; X + 8 <= Width; X += 8)
+			{
+				const __m128i Y = _mm_cvtepu8_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(SrcY + X)));
+				__m128i U;
+				__m128i V;
+				if constexpr (bIsNV12)
+				{
+					const __m128i UV = _mm_shuffle_epi8(
+					    _mm_loadl_epi64(reinterpret_cast<const __m128i*>(SrcU + X)), SplitUV);
+					U = UV;
+					V = _mm_srli_si128(UV, 4);
+				}
+				else
+				{
+					U = _mm_cvtsi32_si128(FPlatformMemory::ReadUnaligned<int32>(SrcU + X / 2));
+					V = _mm_cvtsi32_si128(FPlatformMemory::ReadUnaligned<int32>(SrcV + X / 2));
+				}
+				const __m128i D = _mm_sub_epi16(_mm_cvtepu8_epi16(_mm_unpacklo_epi8(U, U)), ChromaBias);
+				const __m128i E = _mm_sub_epi16(_mm_cvtepu8_epi16(_mm_unpacklo_epi8(V, V)), ChromaBias);
+				const __m128i C = _mm_mullo_epi16(_mm_sub_epi16(Y, Bias), _mm_set1_epi16(KY));
+
+				const __m128i B = _mm_srai_epi16(
+				    _mm_adds_epi16(_mm_adds_epi16(C, _mm_mullo_epi16(D, _mm_set1_epi16(KUB))), Round), 6);
+				const __m128i G = _mm_srai_epi16(
+				    _mm_adds_epi16(_mm_sub_epi16(_mm_sub_epi16(C, _mm_mullo_epi16(D, _mm_set1_epi16(KUG))),
+				                                 _mm_mullo_epi16(E, _mm_set1_epi16(KVG))),
+				                   Round),
+				    6);
+				const __m128i R = _mm_srai_epi16(
+				    _mm_adds_epi16(_mm_adds_epi16(C, _mm_mullo_epi16(E, _mm_set1_epi16(KVR))), Round), 6);
+
+				const __m128i BG = _mm_unpacklo_epi8(_mm_packus_epi16(B, B), _mm_packus_epi16(G, G));
+				const __m128i RA = _mm_unpacklo_epi8(_mm_packus_epi16(R, R), Alpha);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Dest + X * 4), _mm_unpacklo_epi16(BG, RA));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Dest + X * 4 + 16), _mm_unpackhi_epi16(BG, RA));
+			}
+			ConvertRowFrom<bIsNV12>(SrcY, SrcU, SrcV, Dest, Width, X);
+		}
+
+		template <bool bIsNV12>
+		DLB_TARGET("avx2")
+		void ConvertRowAVX2(const uint8* SrcY, const uint8* SrcU, const uint8* SrcV, uint8* Dest, int Width)
+		{
+			const __m256i Bias = _mm256_set1_epi16(16);
+			const __m256i ChromaBias = _mm256_set1_epi16(128);
+			const __m256i Round = _mm256_set1_epi16(32);
+			const __m256i Alpha = _mm256_set1_epi16(255);
+			const __m128i SplitUV = _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
+
+			int X = 0;
+			for (; X + 16 <= Width; X += 16)
+			{
+				const __m256i Y = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(SrcY + X)));
+				__m128i U;
+				__m128i V;
+				if constexpr (bIsNV12)
+				{
+					const __m128i UV =
+					    _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(SrcU + X)), SplitUV);
+					U = UV;
+					V = _mm_srli_si128(UV, 8);
+				}
+				else
+				{
+					U = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(SrcU + X / 2));
+					V = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(SrcV + X / 2));
+				}
+				const __m256i D = _mm256_sub_epi16(_mm256_cvtepu8_epi16(_mm_unpacklo_epi8(U, U)), ChromaBias);
+				const __m256i E = _mm256_sub_epi16(_mm256_cvtepu8_epi16(_mm_unpacklo_epi8(V, V)), ChromaBias);
+				const __m256i C = _mm256_mullo_epi16(_mm256_sub_epi16(Y, Bias), _mm256_set1_epi16(KY));
+
+				const __m256i B = _mm256_srai_epi16(
+				    _mm256_adds_epi16(_mm256_adds_epi16(C, _mm256_mullo_epi16(D, _mm256_set1_epi16(KUB))), Round), 6);
+				const __m256i G = _mm256_srai_epi16(
+				    _mm256_adds_epi16(
+				        _mm256_sub_epi16(_mm256_sub_epi16(C, _mm256_mullo_epi16(D, _mm256_set1_epi16(KUG))),
+				                         _mm256_mullo_epi16(E, _mm256_set1_epi16(KVG))),
+				        Round),
+				    6);
+				const __m256i R = _mm256_srai_epi16(
+				    _mm256_adds_epi16(_mm256_adds_epi16(C, _mm256_mullo_epi16(E, _mm256_set1_epi16(KVR))), Round), 6);
+
+				// Packing works within 128-bit lanes: each lane holds 8 pixels as B G and R A halves, which are
+				// interleaved and then reordered across lanes
+				const __m256i BGHalves = _mm256_packus_epi16(B, G);
+				const __m256i RAHalves = _mm256_packus_epi16(R, Alpha);
+				const __m256i BG = _mm256_unpacklo_epi8(BGHalves, _mm256_srli_si256(BGHalves, 8));
+				const __m256i RA = _mm256_unpacklo_epi8(RAHalves, _mm256_srli_si256(RAHalves, 8));
+				const __m256i Low = _mm256_unpacklo_epi16(BG, RA);
+				const __m256i High = _mm256_unpackhi_epi16(BG, RA);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(Dest + X * 4),
+				                    _mm256_permute2x128_si256(Low, High, 0x20));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(Dest + X * 4 + 32),
+				                    _mm256_permute2x128_si256(Low, High, 0x31));
+			}
+			ConvertRowFrom<bIsNV12>(SrcY, SrcU, SrcV, Dest, Width, X);
+		}
+
+		struct FCpuFeatures
+		{
+			bool bHasSSE41 = false;
+			bool bHasAVX2 = false;
+
+			FCpuFeatures()
+			{
+#if defined(_MSC_VER) && !defined(__clang__)
+				int Info[4];
+				__cpuid(Info, 0);
+				const int MaxLeaf = Info[0];
+				__cpuid(Info, 1);
+				bHasSSE41 = (Info[2] & (1 << 19)) != 0;
+				const bool bHasAVX = (Info[2] & (1 << 27)) && (Info[2] & (1 << 28)) && (_xgetbv(0) & 6) == 6;
+				if (bHasAVX && MaxLeaf >= 7)
+				{
+					__cpuidex(Info, 7, 0);
+					bHasAVX2 = (Info[1] & (1 << 5)) != 0;
+				}
+#else
+				__builtin_cpu_init();
+				bHasSSE41 = __builtin_cpu_supports("sse4.1");
+				bHasAVX2 = __builtin_cpu_supports("avx2");
+#endif
+			}
+		};
+
+		const FCpuFeatures& GetCpuFeatures()
+		{
+			static const FCpuFeatures CpuFeatures;
+			return CpuFeatures;
+		}
+#endif
+
+#if DLB_VIDEO_KERNELS_NEON
+		FORCEINLINE uint8x8x4_t ConvertPixelsNEON(uint8x8_t SrcY, uint8x8_t SrcU, uint8x8_t SrcV)
+		{
+			const int16x8_t C = vmulq_n_s16(vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(SrcY)), vdupq_n_s16(16)), KY);
+			const int16x8_t D = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(SrcU)), vdupq_n_s16(128));
+			const int16x8_t E = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(SrcV)), vdupq_n_s16(128));
+
+			uint8x8x4_t Pixels;
+			Pixels.val[0] = vqrshrun_n_s16(vqaddq_s16(C, vmulq_n_s16(D, KUB)), 6);
+			Pixels.val[1] = vqrshrun_n_s16(vsubq_s16(vsubq_s16(C, vmulq_n_s16(D, KUG)), vmulq_n_s16(E, KVG)), 6);
+			Pixels.val[2] = vqrshrun_n_s16(vqaddq_s16(C, vmulq_n_s16(E, KVR)), 6);
+			Pixels.val[3] = vdup_n_u8(255);
+			return Pixels;
+		}
+
+		template <bool bIsNV12>
+		void ConvertRowNEON(const uint8* SrcY, const uint8* SrcU, const uint8* SrcV, uint8* Dest, int Width)
+		{
+			int X = 0;
+			for (; X + 16 <= Width; X += 16)
+			{
+				const uint8x16_t Y = vld1q_u8(SrcY + X);
+				uint8x8_t U;
+				uint8x8_t V;
+				if constexpr (bIsNV12)
+				{
+					const uint8x8x2_t UV = vld2_u8(SrcU + X);
+					U = UV.val[0];
+					V = UV.val[1];
+				}
+				else
+				{
+					U = vld1_u8(SrcU + X / 2);
+					V = vld1_u8(SrcV + X / 2);
+				}
+				const uint8x8x2_t UU = vzip_u8(U, U);
+				const uint8x8x2_t VV = vzip_u8(V, V);
+				vst4_u8(Dest + X * 4, ConvertPixelsNEON(vget_low_u8(Y), UU.val[0], VV.val[0]));
+				vst4_u8(Dest + X * 4 + 32, ConvertPixelsNEON(vget_high_u8(Y), UU.val[1], VV.val[1]));
+			}
+			ConvertRowFrom<bIsNV12>(SrcY, SrcU, SrcV, Dest, Width, X);
+		}
+#endif
+
+		template <bool bIsNV12>
+		FConvertRow GetConvertRow(EVideoConverter Converter)
+		{
+			switch (IsVideoConverterSupported(Converter) ? Converter : EVideoConverter::Scalar)
+			{
+#if DLB_VIDEO_KERNELS_X86
+				case EVideoConverter::SSE41:
+					return &ConvertRowSSE41<bIsNV12>;
+				case EVideoConverter::AVX2:
+					return &ConvertRowAVX2<bIsNV12>;
+#endif
+#if DLB_VIDEO_KERNELS_NEON
+				case EVideoConverter::NEON:
+					return &ConvertRowNEON<bIsNV12>;
+#endif
+				default:
+					return &ConvertRowScalar<bIsNV12>;
+			}
+		}
+	}
+
+	const TCHAR* ToString(EVideoConverter Converter)
+	{
+		switch (Converter)
+		{
+			case EVideoConverter::Sdk:
+				return TEXT("SDK");
+			case EVideoConverter::Scalar:
+				return TEXT("Scalar");
+			case EVideoConverter::SSE41:
+				return TEXT("SSE4.1");
+			case EVideoConverter::AVX2:
+				return TEXT("AVX2");
+			case EVideoConverter::NEON:
+				return TEXT("NEON");
+		}
+		return TEXT("Unknown");
+	}
+
+	bool IsVideoConverterSupported(EVideoConverter Converter)
+	{
+		switch (Converter)
+		{
+			case EVideoConverter::Sdk:
+			case EVideoConverter::Scalar:
+				return true;
+#if DLB_VIDEO_KERNELS_X86
+			case EVideoConverter::SSE41:
+				return GetCpuFeatures().bHasSSE41;
+			case EVideoConverter::AVX2:
+				return GetCpuFeatures().bHasAVX2;
+#endif
+#if DLB_VIDEO_KERNELS_NEON
+			case EVideoConverter::NEON:
+				return true;
+#endif
+			default:
+				return false;
+		}
+	}
+
+	EVideoConverter GetBestVideoConverter()
+	{
+		for (EVideoConverter Converter : {EVideoConverter::AVX2, EVideoConverter::SSE41, EVideoConverter::NEON})
+		{
+			if (IsVideoConverterSupported(Converter))
+			{
+				return Converter;
+			}
+		}
+		return EVideoConverter::Scalar;
+	}
+
+	void ConvertI420ToBGRA(EVideoConverter Converter, const uint8* SrcY, int StrideY, const uint8* SrcU, int StrideU,
+	                       const uint8* SrcV, int StrideV, uint8* Dest, int DestStride, int Width, int Height)
+	{
+		if (Converter == EVideoConverter::Sdk)
+		{
+			return dolbyio::comms::video_utils::format_converter::i420_to_argb(
+			    SrcY, StrideY, SrcU, StrideU, SrcV, StrideV, Dest, DestStride, Width, Height);
+		}
+
+		const FConvertRow ConvertRow = GetConvertRow<false>(Converter);
+		for (int Row = 0; Row < Height; ++Row)
+		{
+			const int ChromaRow = Row / 2;
+			ConvertRow(SrcY + Row * StrideY, SrcU + ChromaRow * StrideU, SrcV + ChromaRow * StrideV,
+			           Dest + Row * DestStride, Width);
+		}
+	}
+
+	void ConvertNV12ToBGRA(EVideoConverter Converter, const uint8* SrcY, int StrideY, const uint8* SrcUV,
+	                       int StrideUV, uint8* Dest, int DestStride, int Width, int Height)
+	{
+		if (Converter == EVideoConverter::Sdk)
+		{
+			return dolbyio::comms::video_utils::format_converter::nv12_to_argb(SrcY, StrideY, SrcUV, StrideUV,
+			                                                                   Dest, DestStride, Width, Height);
+		}
+
+		const FConvertRow ConvertRow = GetConvertRow<true>(Converter);
+		for (int Row = 0; Row < Height; ++Row)
+		{
+			ConvertRow(SrcY + Row * StrideY, SrcUV + Row / 2 * StrideUV, nullptr, Dest + Row * DestStride, Width);
+		}
+	}
+}
@@ -0,0 +1,29 @@
+// Copyright 2023 Dolby Laboratories
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace DolbyIO
+{
+	/** Converters from YUV (BT.601, limited range) to BGRA. The plugin's own kernels produce identical output, SDK
+	 * uses video_utils::format_converter. */
+	enum class EVideoConverter : uint8
+	{
+		Sdk,
+		Scalar,
+		SSE41,
+		AVX2,
+		NEON,
+	};
+
+	const TCHAR* ToString(EVideoConverter Converter);
+	bool IsVideoConverterSupported(EVideoConverter Converter);
+	/** Returns the fastest of the plugin's kernels supported by the CPU. */
+	EVideoConverter GetBestVideoConverter();
+
+	void ConvertI420ToBGRA(EVideoConverter Converter, const uint8* SrcY, int StrideY, const uint8* SrcU, int StrideU,
+	                       const uint8* SrcV, int StrideV, uint8* Dest, int DestStride, int Width, int Height);
+	void ConvertNV12ToBGRA(EVideoConverter Converter, const uint8* SrcY, int StrideY, const uint8* SrcUV,
+	                       int StrideUV, uint8* Dest, int DestStride, int Width, int Height);
+}
@@ -0,0 +1,61 @@
+// Copyright 2023 Dolby Laboratories
+
+#include "DolbyIOVideoRHI.h"
+
+#include "Engine/Texture2D.h"
+#include "RHI.h"
+#include "Runtime/Launch/Resources/Version.h"
+#include "TextureResource.h"
+
+namespace DolbyIO
+{
+	FTexture2DRHIRef CreateTextureRHI(const TCHAR* Name, int Width, int Height, EPixelFormat Format,
+	                                  ETextureCreateFlags Flags)
+	{
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+		return RHICreateTexture(FRHITextureCreateDesc::Create2D(Name, Width, Height, Format)
+		                            .SetFlags(Flags)
+		                            .SetInitialState(ERHIAccess::SRVMask));
+#else
+		FRHIResourceCreateInfo CreateInfo{Name};
+		return RHICreateTexture2D(Width, Height, Format, 1, 1, Flags, ERHIAccess::SRVMask, CreateInfo);
+#endif
+	}
+
+	bool EnsureTextureRHI(FTexture2DRHIRef& TextureRHI, const TCHAR* Name, int Width, int Height, EPixelFormat Format,
+	                      ETextureCreateFlags Flags)
+	{
+		if (TextureRHI && TextureRHI->GetFormat() == Format && TextureRHI->GetSizeX() == static_cast<uint32>(Width) &&
+		    TextureRHI->GetSizeY() == static_cast<uint32>(Height))
+		{
+			return false;
+		}
+		TextureRHI = CreateTextureRHI(Name, Width, Height, Format, Flags);
+		return true;
+	}
+
+	void UploadToTextureRHI(FRHITexture2D* TextureRHI, const uint8* Data, int Width, int Height, int Pitch,
+	                        FIntPoint Offset)
+	{
+		RHIUpdateTexture2D(TextureRHI, 0,
+		                   FUpdateTextureRegion2D{static_cast<uint32>(Offset.X), static_cast<uint32>(Offset.Y), 0, 0,
+		                                          static_cast<uint32>(Width), static_cast<uint32>(Height)},
+		                   Pitch, Data);
+	}
+
+	bool SwapInTextureRHI(UTexture2D& Texture, FRHITexture* TextureRHI)
+	{
+		FTextureResource* Resource = Texture.GetResource();
+		if (!Resource || Resource->TextureRHI == TextureRHI)
+		{
+			return false;
+		}
+
+		Resource->TextureRHI = TextureRHI;
+		if (FRHITextureReference* TextureReference = Texture.TextureReference.TextureReferenceRHI)
+		{
+			RHIUpdateTextureReference(TextureReference, TextureRHI);
+		}
+		return true;
+	}
+}
@@ -0,0 +1,26 @@
+// Copyright 2023 Dolby Laboratories
+
+#pragma once
+
+#include "RHIResources.h"
+
+class UTexture2D;
+
+// Must be called on the rendering thread
+namespace DolbyIO
+{
+	FTexture2DRHIRef CreateTextureRHI(const TCHAR* Name, int Width, int Height, EPixelFormat Format,
+	                                  ETextureCreateFlags Flags);
+
+	/** Recreates the texture unless it already has the given format and size, returns true if it was recreated. */
+	bool EnsureTextureRHI(FTexture2DRHIRef& TextureRHI, const TCHAR* Name, int Width, int Height, EPixelFormat Format,
+	                      ETextureCreateFlags Flags = TexCreate_ShaderResource);
+
+	void UploadToTextureRHI(FRHITexture2D* TextureRHI, const uint8* Data, int Width, int Height, int Pitch,
+	                        FIntPoint Offset = {0, 0});
+
+	/** Makes the texture's resource use the given RHI texture without recreating the resource, returns true unless it
+	 * already did. Uniform expressions of materials using the texture need to be recached on the game thread
+	 * afterwards. */
+	bool SwapInTextureRHI(UTexture2D& Texture, FRHITexture* TextureRHI);
+}
@@ -0,0 +1,512 @@
+// Copyright 2023 Dolby Laboratories
+
+#include "DolbyIOVideoSink.h"
+
+#include "DolbyIOVideoConversion.h"
+#include "DolbyIOVideoTexture.h"
+#include "DolbyIOVideoUploadScheduler.h"
+#include "Utils/DolbyIOLLM.h"
+#include "Utils/DolbyIOLogging.h"
+#include "Utils/DolbyIOStats.h"
+#include "Utils/DolbyIOTrace.h"
+
+#include "Async/Async.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/Texture2D.h"
+#include "GameFramework/Actor.h"
+#include "Materials/MaterialInstanceDynamic.h"
+
+namespace DolbyIO
+{
+	using namespace dolbyio::comms;
+
+	namespace
+	{
+		constexpr auto TexParamName = "DolbyIO Frame";
+		constexpr auto UVParamName = "DolbyIO UV";
+
+		std::atomic<int64> ActiveSinks{0};
+
+		void BindMaterialImpl(UMaterialInstanceDynamic& Material, FVideoTexture& Texture)
+		{
+			Material.SetTextureParameterValue(TexParamName, Texture.GetTexture());
+			Material.SetVectorParameterValue(UVParamName, Texture.GetUVScaleOffset());
+		}
+
+		void UnbindMaterialImpl(UMaterialInstanceDynamic& Material)
+		{
+			Material.SetTextureParameterValue(TexParamName, FVideoTexture::GetEmptyTexture());
+			Material.SetVectorParameterValue(UVParamName, FLinearColor{1.0f, 1.0f, 0.0f, 0.0f});
+		}
+
+		// Materials created for a primitive or an actor are owned by it, other materials are assumed to be rendered
+		bool WasRecentlyRendered(const UMaterialInstanceDynamic& Material)
+		{
+			constexpr float Tolerance = 0.2f;
+			for (UObject* Outer = Material.GetOuter(); Outer; Outer = Outer->GetOuter())
+			{
+				if (const UPrimitiveComponent* Primitive = Cast<UPrimitiveComponent>(Outer))
+				{
+					return Primitive->WasRecentlyRendered(Tolerance);
+				}
+				if (const AActor* Actor = Cast<AActor>(Outer))
+				{
+					return Actor->WasRecentlyRendered(Tolerance);
+				}
+			}
+			return true;
+		}
+	}
+
+	FVideoSink::FVideoSink(const FString& VideoTrackID, TWeakPtr<FVideoAtlas, ESPMode::ThreadSafe> Atlas)
+	    : Texture(MakeShared<FVideoTexture, ESPMode::ThreadSafe>(MoveTemp(Atlas))), VideoTrackID(VideoTrackID)
+	{
+		TRACE_COUNTER_SET(DolbyIOActiveSinks, ++ActiveSinks);
+	}
+
+	FVideoSink::~FVideoSink()
+	{
+		TRACE_COUNTER_SET(DolbyIOActiveSinks, --ActiveSinks);
+	}
+
+	void FVideoSink::OnTextureCreated(FOnTextureCreated OnTextureCreated)
+	{
+		FScopeLock Lock{&OnTexCreatedLock};
+		if (GetTexture())
+		{
+			return OnTextureCreated();
+		}
+		OnTexCreated = MoveTemp(OnTextureCreated);
+	}
+
+	UTexture2D* FVideoSink::GetTexture()
+	{
+		return Texture->GetTexture();
+	}
+
+	void FVideoSink::BindMaterial(UMaterialInstanceDynamic* Material)
+	{
+		if (IsValid(Material))
+		{
+			DLB_UE_LOG("Binding material %u to video track ID %s", Material->GetUniqueID(), *VideoTrackID);
+			Materials.Add(Material);
+			if (GetTexture())
+			{
+				BindMaterialImpl(*Material, *Texture);
+			}
+		}
+	}
+
+	void FVideoSink::UnbindMaterial(UMaterialInstanceDynamic* Material)
+	{
+		if (Materials.Remove(Material) && IsValid(Material))
+		{
+			DLB_UE_LOG("Unbinding material %u from video track ID %s", Material->GetUniqueID(), *VideoTrackID);
+			UnbindMaterialImpl(*Material);
+		}
+	}
+
+	void FVideoSink::UnbindAllMaterials()
+	{
+		AsyncTask(ENamedThreads::GameThread,
+		          [MaterialsArray = Materials.Array()]
+		          {
+			          for (UMaterialInstanceDynamic* Material : MaterialsArray)
+			          {
+				          if (IsValid(Material))
+				          {
+					          UnbindMaterialImpl(*Material);
+				          }
+			          }
+		          });
+	}
+
+	void FVideoSink::Disable()
+	{
+		bIsEnabled = false;
+	}
+
+	void FVideoSink::SetConversionMode(EDolbyIOVideoConversionMode ConversionMode)
+	{
+		bConvertOnGpu = ConversionMode == EDolbyIOVideoConversionMode::GPU;
+	}
+
+	void FVideoSink::SetParallelConversion(bool bEnabled)
+	{
+		bIsParallelConversionEnabled = bEnabled;
+	}
+
+	void FVideoSink::handle_frame(const video_frame& VideoFrame)
+	{
+		HandleFrame(FPendingFrame{VideoFrame.video_frame_buffer(), nullptr, VideoFrame.width(), VideoFrame.height(),
+		                          FPlatformTime::Seconds()});
+	}
+
+	void FVideoSink::HandleSyntheticFrame(std::shared_ptr<const FVideoPlanes> Planes)
+	{
+		const int Width = Planes->Width;
+		const int Height = Planes->Height;
+		HandleFrame(FPendingFrame{nullptr, MoveTemp(Planes), Width, Height, FPlatformTime::Seconds()});
+	}
+
+	void FVideoSink::HandleFrame(FPendingFrame&& Frame)
+	{
+		DLB_TRACE_SCOPE(HandleFrame);
+		Texture->GetStats().RecordReceived();
+
+		// The first frame is always converted so that the texture gets created
+		if (!bIsEnabled || (bIsTextureRequested && !bIsVisible) || ShouldDropFrame())
+		{
+			return;
+		}
+
+		// Only the buffer is kept and a newer frame replaces one which is still waiting. Frames are converted by
+		// whoever schedules the conversion first, so a track is never converted on two threads at once.
+		bool bShouldConvert;
+		{
+			FScopeLock Lock{&PendingFrameLock};
+			PendingFrame = MoveTemp(Frame);
+			bShouldConvert = !bIsConversionScheduled;
+			bIsConversionScheduled = true;
+		}
+		if (!bShouldConvert)
+		{
+			return;
+		}
+
+		if (bIsParallelConversionEnabled)
+		{
+			AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask,
+			          [This = shared_from_this()] { This->ConvertPendingFrames(); });
+		}
+		else
+		{
+			ConvertPendingFrames();
+		}
+	}
+
+	void FVideoSink::ConvertPendingFrames()
+	{
+		for (;;)
+		{
+			FPendingFrame Frame;
+			{
+				FScopeLock Lock{&PendingFrameLock};
+				if (!PendingFrame.Buffer && !PendingFrame.Planes)
+				{
+					bIsConversionScheduled = false;
+					return;
+				}
+				Frame = MoveTemp(PendingFrame);
+			}
+
+			if (!bIsEnabled)
+			{
+				continue;
+			}
+			if (Frame.Planes)
+			{
+				LLM_SCOPE_BYTAG(DolbyIO_Video);
+				ConvertPlanes(*Frame.Planes, Frame.ArrivalTime);
+			}
+			else
+			{
+				Convert(MoveTemp(Frame.Buffer), Frame.Width, Frame.Height, Frame.ArrivalTime);
+			}
+			OnFrameConverted();
+		}
+	}
+
+	void FVideoSink::OnFrameConverted()
+	{
+		// The frame waits in the texture's buffer until the game thread creates the texture, so the thread converting
+		// frames never waits for the game thread
+		if (!bIsTextureRequested.exchange(true))
+		{
+			AsyncTask(ENamedThreads::GameThread,
+			          [WeakThis = weak_from_this()]
+			          {
+				          if (std::shared_ptr<FVideoSink> This = WeakThis.lock())
+				          {
+					          This->CreateTexture();
+				          }
+			          });
+		}
+		FVideoUploadScheduler::Schedule(Texture);
+	}
+
+	void FVideoSink::CreateTexture()
+	{
+		DLB_TRACE_SCOPE(CreateTexture);
+		Texture->CreateTexture();
+		UTexture2D* Tex = GetTexture();
+		DLB_UE_LOG("Created texture %u for video track ID %s %dx%d", Tex->GetUniqueID(), *VideoTrackID,
+		           Tex->GetSizeX(), Tex->GetSizeY());
+
+		Texture->OnDisplayChanged(
+		    [WeakThis = weak_from_this()]
+		    {
+			    if (std::shared_ptr<FVideoSink> This = WeakThis.lock())
+			    {
+				    This->BindAllMaterials();
+			    }
+		    });
+		BindAllMaterials();
+
+		// Frames which arrived before the texture existed were not uploaded
+		FVideoUploadScheduler::Schedule(Texture);
+
+		// Called outside the lock, which callbacks registered with the subsystem's locks held would otherwise invert
+		FOnTextureCreated Callback;
+		{
+			FScopeLock Lock{&OnTexCreatedLock};
+			Callback = MoveTemp(OnTexCreated);
+			OnTexCreated = [] {};
+		}
+		Callback();
+	}
+
+	void FVideoSink::BindAllMaterials()
+	{
+		for (UMaterialInstanceDynamic* Material : Materials)
+		{
+			if (IsValid(Material))
+			{
+				BindMaterialImpl(*Material, *Texture);
+			}
+		}
+	}
+
+	void FVideoSink::ResizeTexture(int Width, int Height, FVideoTexture::EBufferFormat Format)
+	{
+		if (Texture->Resize(Width, Height, Format))
+		{
+			AsyncTask(ENamedThreads::GameThread,
+			          [=, Tex = Texture]
+			          {
+				          if (UTexture2D* Texture2D = Tex->GetTexture())
+				          {
+					          DLB_UE_LOG("Resizing texture %u: old %dx%d new %dx%d", Texture2D->GetUniqueID(),
+					                     Texture2D->GetSizeX(), Texture2D->GetSizeY(), Width, Height);
+				          }
+			          });
+		}
+	}
+
+	void FVideoSink::SetMaxResolution(int MaxWidth, int MaxHeight)
+	{
+		MaxSize = FIntPoint{FMath::Max(MaxWidth, 0), FMath::Max(MaxHeight, 0)};
+	}
+
+	void FVideoSink::SetMaxFrameRate(float MaxFrameRate)
+	{
+		MinFrameInterval = MaxFrameRate > 0.0f ? 1.0 / MaxFrameRate : 0.0;
+	}
+
+	uint64 FVideoSink::GetDroppedFrameCount() const
+	{
+		return DroppedFrameCount;
+	}
+
+	FDolbyIOVideoTrackStats FVideoSink::GetStats()
+	{
+		return Texture->GetStats().Get(VideoTrackID);
+	}
+
+	void FVideoSink::UpdateVisibility()
+	{
+		bool bIsRendered = !Materials.Num();
+		for (UMaterialInstanceDynamic* Material : Materials)
+		{
+			if (IsValid(Material) && WasRecentlyRendered(*Material))
+			{
+				bIsRendered = true;
+				break;
+			}
+		}
+
+		if (bIsVisible.exchange(bIsRendered) != bIsRendered)
+		{
+			DLB_UE_LOG_BASE(Verbose, "%s video track ID %s", bIsRendered ? TEXT("Resuming") : TEXT("Suspending"),
+			                *VideoTrackID);
+		}
+	}
+
+	void FVideoSink::ResetVisibility()
+	{
+		bIsVisible = true;
+	}
+
+	bool FVideoSink::ShouldDropFrame()
+	{
+		const double Interval = MinFrameInterval;
+		if (Interval <= 0.0)
+		{
+			return false;
+		}
+
+		// Frames are allowed to arrive slightly early so that jitter does not halve the rate when the source rate is
+		// a multiple of the maximum rate
+		const double Now = FPlatformTime::Seconds();
+		if (Now < NextFrameTime - Interval * 0.2)
+		{
+			++DroppedFrameCount;
+			return true;
+		}
+		NextFrameTime = FMath::Max(NextFrameTime + Interval, Now);
+		return false;
+	}
+
+	FIntPoint FVideoSink::GetTargetSize(int Width, int Height) const
+	{
+		const FIntPoint Max = MaxSize;
+		double Scale = 1.0;
+		if (Max.X && Width > Max.X)
+		{
+			Scale = static_cast<double>(Max.X) / Width;
+		}
+		if (Max.Y && Height > Max.Y)
+		{
+			Scale = FMath::Min(Scale, static_cast<double>(Max.Y) / Height);
+		}
+		if (Scale == 1.0)
+		{
+			return {Width, Height};
+		}
+		return {FMath::Max(FMath::RoundToInt(Width * Scale), 1), FMath::Max(FMath::RoundToInt(Height * Scale), 1)};
+	}
+
+	namespace
+	{
+#if PLATFORM_MAC
+		class FLockedCVPixelBuffer
+		{
+		public:
+			FLockedCVPixelBuffer(CVPixelBufferRef PixelBuffer) : PixelBuffer(PixelBuffer)
+			{
+				CVPixelBufferLockBaseAddress(PixelBuffer, kCVPixelBufferLock_ReadOnly);
+			}
+			~FLockedCVPixelBuffer()
+			{
+				CVPixelBufferUnlockBaseAddress(PixelBuffer, kCVPixelBufferLock_ReadOnly);
+			}
+
+			operator CVPixelBufferRef() const
+			{
+				return PixelBuffer;
+			}
+
+		private:
+			CVPixelBufferRef PixelBuffer;
+		};
+#endif
+	}
+
+	void FVideoSink::Convert(std::shared_ptr<video_frame_buffer> VideoFrameBuffer, int Width, int Height,
+	                         double ArrivalTime)
+	{
+		if (!VideoFrameBuffer)
+		{
+			return;
+		}
+
+		LLM_SCOPE_BYTAG(DolbyIO_Video);
+#if !PLATFORM_MAC
+		if (VideoFrameBuffer->type() == video_frame_buffer::type::native)
+		{
+			if (std::shared_ptr<video_frame_buffer_i420_interface> BufferI420 = VideoFrameBuffer->to_i420())
+			{
+				VideoFrameBuffer = std::move(BufferI420);
+			}
+		}
+#endif
+
+		FVideoPlanes Planes;
+		Planes.Width = Width;
+		Planes.Height = Height;
+		enum video_frame_buffer::type VideoFrameBufferType = VideoFrameBuffer->type();
+
+		if (VideoFrameBufferType == video_frame_buffer::type::argb)
+		{
+			if (const video_frame_buffer_argb_interface* FrameARGB = VideoFrameBuffer->get_argb())
+			{
+				Planes.Format = FVideoTexture::EBufferFormat::BGRA;
+				Planes.Data[0] = FrameARGB->data();
+				Planes.Stride[0] = FrameARGB->stride();
+				ConvertPlanes(Planes, ArrivalTime);
+			}
+		}
+		else if (VideoFrameBufferType == video_frame_buffer::type::i420)
+		{
+			if (const video_frame_buffer_i420_interface* FrameI420 = VideoFrameBuffer->get_i420())
+			{
+				Planes.Format = FVideoTexture::EBufferFormat::I420;
+				Planes.Data[0] = FrameI420->data_y();
+				Planes.Stride[0] = FrameI420->stride_y();
+				Planes.Data[1] = FrameI420->data_u();
+				Planes.Stride[1] = FrameI420->stride_u();
+				Planes.Data[2] = FrameI420->data_v();
+				Planes.Stride[2] = FrameI420->stride_v();
+				ConvertPlanes(Planes, ArrivalTime);
+			}
+		}
+		else if (VideoFrameBufferType == video_frame_buffer::type::nv12)
+		{
+			if (const video_frame_buffer_nv12_interface* FrameNV12 = VideoFrameBuffer->get_nv12())
+			{
+				Planes.Format = FVideoTexture::EBufferFormat::NV12;
+				Planes.Data[0] = FrameNV12->data_y();
+				Planes.Stride[0] = FrameNV12->stride_y();
+				Planes.Data[1] = FrameNV12->data_uv();
+				Planes.Stride[1] = FrameNV12->stride_uv();
+				ConvertPlanes(Planes, ArrivalTime);
+			}
+		}
+#if PLATFORM_MAC
+		else if (VideoFrameBufferType == video_frame_buffer::type::native)
+		{
+			if (const video_frame_buffer_native_interface* FrameNative = VideoFrameBuffer->get_native())
+			{
+				FLockedCVPixelBuffer PixelBuffer{FrameNative->cv_pixel_buffer_ref()};
+				Planes.Format = FVideoTexture::EBufferFormat::NV12;
+				Planes.Data[0] = static_cast<uint8*>(CVPixelBufferGetBaseAddressOfPlane(PixelBuffer, 0));
+				Planes.Stride[0] = CVPixelBufferGetBytesPerRowOfPlane(PixelBuffer, 0);
+				Planes.Data[1] = static_cast<uint8*>(CVPixelBufferGetBaseAddressOfPlane(PixelBuffer, 1));
+				Planes.Stride[1] = CVPixelBufferGetBytesPerRowOfPlane(PixelBuffer, 1);
+				ConvertPlanes(Planes, ArrivalTime);
+			}
+		}
+#endif
+	}
+
+	void FVideoSink::ConvertPlanes(const FVideoPlanes& Planes, double ArrivalTime)
+	{
+		DLB_TRACE_SCOPE(Convert);
+		SCOPE_CYCLE_COUNTER(STAT_DolbyIO_ConvertFrame);
+		const double Start = FPlatformTime::Seconds();
+		const FIntPoint TargetSize = GetTargetSize(Planes.Width, Planes.Height);
+
+		// Frames are downscaled while copying their planes, so the conversion and the upload work on the smaller frame
+		if (Planes.Format == FVideoTexture::EBufferFormat::BGRA || bConvertOnGpu)
+		{
+			ResizeTexture(TargetSize.X, TargetSize.Y, Planes.Format);
+			PackPlanes(Planes, Texture->GetBuffer(), TargetSize.X, TargetSize.Y);
+		}
+		else if (TargetSize != FIntPoint{Planes.Width, Planes.Height})
+		{
+			ScaledPlanes.SetNumUninitialized(FVideoTexture::GetBufferSize(TargetSize.X, TargetSize.Y, Planes.Format),
+			                                 false);
+			PackPlanes(Planes, ScaledPlanes.GetData(), TargetSize.X, TargetSize.Y);
+			ResizeTexture(TargetSize.X, TargetSize.Y, FVideoTexture::EBufferFormat::BGRA);
+			ConvertToBGRA(FVideoPlanes::FromPacked(ScaledPlanes.GetData(), Planes.Format, TargetSize.X, TargetSize.Y),
+			              Texture->GetBuffer(), TargetSize.X * FVideoTexture::Stride);
+		}
+		else
+		{
+			ResizeTexture(TargetSize.X, TargetSize.Y, FVideoTexture::EBufferFormat::BGRA);
+			ConvertToBGRA(Planes, Texture->GetBuffer(), TargetSize.X * FVideoTexture::Stride);
+		}
+		Texture->GetStats().RecordConverted({Planes.Width, Planes.Height}, FPlatformTime::Seconds() - Start);
+		Texture->PublishFrame(ArrivalTime);
+	}
+}
@@ -0,0 +1,108 @@
+// Copyright 2023 Dolby Laboratories
+
+#pragma once
+
+#include "Utils/DolbyIOCppSdk.h"
+#include "Video/DolbyIOVideoTexture.h"
+
+#include "DolbyIOTypes.h"
+#include "Templates/SharedPointer.h"
+
+#include <atomic>
+#include <memory>
+
+class UMaterialInstanceDynamic;
+class UTexture2D;
+
+namespace DolbyIO
+{
+	struct FVideoPlanes;
+
+	class FVideoSink final : public dolbyio::comms::video_sink, public std::enable_shared_from_this<FVideoSink>
+	{
+		using FOnTextureCreated = TFunction<void(void)>;
+
+	public:
+		FVideoSink(const FString& VideoTrackID, TWeakPtr<FVideoAtlas, ESPMode::ThreadSafe> Atlas = nullptr);
+		~FVideoSink();
+
+		/** Runs the callback right away on the calling thread if the texture exists, otherwise on the game thread once
+		 * it is created. */
+		void OnTextureCreated(FOnTextureCreated OnTextureCreated);
+
+		UTexture2D* GetTexture();
+		void BindMaterial(UMaterialInstanceDynamic* Material);
+		void UnbindMaterial(UMaterialInstanceDynamic* Material);
+		void UnbindAllMaterials();
+		void Disable();
+		void SetConversionMode(EDolbyIOVideoConversionMode ConversionMode);
+		/** Frames larger than the maximum resolution are downscaled preserving their aspect ratio, 0 means no limit. */
+		void SetMaxResolution(int MaxWidth, int MaxHeight);
+		/** Frames arriving faster than the maximum frame rate are dropped before being converted, 0 means no limit. */
+		void SetMaxFrameRate(float MaxFrameRate);
+		uint64 GetDroppedFrameCount() const;
+		FDolbyIOVideoTrackStats GetStats();
+		/** Frames are not converted while none of the bound materials was recently rendered, must be called on the
+		 * game thread. */
+		void UpdateVisibility();
+		void ResetVisibility();
+
+		/** Handles a frame which did not come from the SDK, such as those of FFakeConference, exactly like frames
+		 * delivered by the SDK. The planes must stay valid while they are referenced. */
+		void HandleSyntheticFrame(std::shared_ptr<const FVideoPlanes> Planes);
+
+		/** When enabled, frames are converted on the task graph instead of the thread delivering them. Frames of one
+		 * track are still converted one at a time and only the newest waiting frame is kept. */
+		void SetParallelConversion(bool bEnabled);
+
+	private:
+		friend class FVideoPipelineBenchmark;
+
+		void handle_frame(const dolbyio::comms::video_frame&) override;
+
+		struct FPendingFrame
+		{
+			std::shared_ptr<dolbyio::comms::video_frame_buffer> Buffer;
+			std::shared_ptr<const FVideoPlanes> Planes;
+			int Width = 0;
+			int Height = 0;
+			double ArrivalTime = 0.0;
+		};
+
+		void HandleFrame(FPendingFrame&& Frame);
+
+		void CreateTexture();
+		void BindAllMaterials();
+		void ResizeTexture(int Width, int Height, FVideoTexture::EBufferFormat Format);
+		bool ShouldDropFrame();
+		FIntPoint GetTargetSize(int Width, int Height) const;
+		void ConvertPendingFrames();
+		void Convert(std::shared_ptr<dolbyio::comms::video_frame_buffer> VideoFrameBuffer, int Width, int Height,
+		             double ArrivalTime);
+		void ConvertPlanes(const FVideoPlanes& Planes, double ArrivalTime);
+		void OnFrameConverted();
+
+		const TSharedRef<FVideoTexture, ESPMode::ThreadSafe> Texture;
+		TSet<UMaterialInstanceDynamic*> Materials;
+		const FString VideoTrackID;
+		FOnTextureCreated OnTexCreated = [] {};
+		FCriticalSection OnTexCreatedLock;
+		bool bIsEnabled = true;
+		std::atomic<bool> bIsTextureRequested{false};
+		std::atomic<bool> bConvertOnGpu{false};
+		std::atomic<bool> bIsParallelConversionEnabled{false};
+		std::atomic<FIntPoint> MaxSize{FIntPoint{0, 0}};
+		std::atomic<bool> bIsVisible{true};
+		std::atomic<double> MinFrameInterval{0.0};
+		std::atomic<uint64> DroppedFrameCount{0};
+		FPendingFrame PendingFrame;
+		bool bIsConversionScheduled = false;
+		FCriticalSection PendingFrameLock;
+
+		// Only accessed on the thread delivering frames
+		double NextFrameTime = 0.0;
+
+		// Only accessed by the conversion, which never runs concurrently with itself
+		TArray<uint8> ScaledPlanes;
+	};
+}
@@ -0,0 +1,106 @@
+// Copyright 2023 Dolby Laboratories
+
+#include "DolbyIOVideoStats.h"
+
+namespace DolbyIO
+{
+	void FVideoStats::FRate::Add(double Now)
+	{
+		++Count;
+		Get(Now);
+	}
+
+	float FVideoStats::FRate::Get(double Now)
+	{
+		const double Elapsed = Now - WindowStart;
+		if (Elapsed >= 1.0)
+		{
+			Rate = static_cast<float>(Count / Elapsed);
+			Count = 0;
+			WindowStart = Now;
+		}
+		return Rate;
+	}
+
+	void FVideoStats::FSamples::Add(double Seconds)
+	{
+		const float Milliseconds = static_cast<float>(Seconds * 1000.0);
+		if (Values.Num() < Capacity)
+		{
+			Values.Add(Milliseconds);
+			return;
+		}
+		Values[Next] = Milliseconds;
+		Next = (Next + 1) % Capacity;
+	}
+
+	float FVideoStats::FSamples::GetAverage() const
+	{
+		if (!Values.Num())
+		{
+			return 0.0f;
+		}
+		float Sum = 0.0f;
+		for (float Value : Values)
+		{
+			Sum += Value;
+		}
+		return Sum / Values.Num();
+	}
+
+	float FVideoStats::FSamples::GetPercentile(float Percentile) const
+	{
+		if (!Values.Num())
+		{
+			return 0.0f;
+		}
+		TArray<float> Sorted = Values;
+		Sorted.Sort();
+		return Sorted[FMath::Clamp(FMath::CeilToInt(Percentile / 100.0f * Sorted.Num()) - 1, 0, Sorted.Num() - 1)];
+	}
+
+	void FVideoStats::RecordReceived()
+	{
+		FScopeLock ScopeLock{&Lock};
+		++ReceivedCount;
+		ReceivedRate.Add(FPlatformTime::Seconds());
+	}
+
+	void FVideoStats::RecordConverted(FIntPoint FrameSize, double ConversionTime)
+	{
+		FScopeLock ScopeLock{&Lock};
+		Size = FrameSize;
+		ConversionTimes.Add(ConversionTime);
+	}
+
+	void FVideoStats::RecordUploaded(double UploadTime, double ArrivalTime)
+	{
+		const double Now = FPlatformTime::Seconds();
+		FScopeLock ScopeLock{&Lock};
+		++RenderedCount;
+		RenderedRate.Add(Now);
+		UploadTimes.Add(UploadTime);
+		Latencies.Add(Now - ArrivalTime);
+	}
+
+	FDolbyIOVideoTrackStats FVideoStats::Get(const FString& VideoTrackID)
+	{
+		const double Now = FPlatformTime::Seconds();
+		FScopeLock ScopeLock{&Lock};
+
+		FDolbyIOVideoTrackStats Stats;
+		Stats.TrackID = VideoTrackID;
+		Stats.ReceivedFrameRate = ReceivedRate.Get(Now);
+		Stats.RenderedFrameRate = RenderedRate.Get(Now);
+		Stats.DroppedFrames = FMath::Max(ReceivedCount - RenderedCount, int64{0});
+		Stats.Width = Size.X;
+		Stats.Height = Size.Y;
+		Stats.AverageConversionTime = ConversionTimes.GetAverage();
+		Stats.P95ConversionTime = ConversionTimes.GetPercentile(95.0f);
+		Stats.AverageUploadTime = UploadTimes.GetAverage();
+		Stats.P95UploadTime = UploadTimes.GetPercentile(95.0f);
+		Stats.AverageLatency = Latencies.GetAverage();
+		Stats.P95Latency = Latencies.GetPercentile(95.0f);
+		return Stats;
+	}
+}
@@ -0,0 +1,61 @@
+// Copyright 2023 Dolby Laboratories
+
+#pragma once
+
+#include "DolbyIOTypes.h"
+
+#include "HAL/CriticalSection.h"
+#include "HAL/PlatformTime.h"
+
+namespace DolbyIO
+{
+	/** Collects the statistics of a video track on the threads delivering, converting and uploading its frames. Times
+	 * are in seconds as returned by FPlatformTime::Seconds. */
+	class FVideoStats final
+	{
+	public:
+		void RecordReceived();
+		void RecordConverted(FIntPoint FrameSize, double ConversionTime);
+		void RecordUploaded(double UploadTime, double ArrivalTime);
+
+		FDolbyIOVideoTrackStats Get(const FString& VideoTrackID);
+
+	private:
+		/** Frames per second over the last full second. */
+		class FRate
+		{
+		public:
+			void Add(double Now);
+			float Get(double Now);
+
+		private:
+			double WindowStart = FPlatformTime::Seconds();
+			int Count = 0;
+			float Rate = 0.0f;
+		};
+
+		/** The most recent samples in milliseconds. */
+		class FSamples
+		{
+		public:
+			void Add(double Seconds);
+			float GetAverage() const;
+			float GetPercentile(float Percentile) const;
+
+		private:
+			static constexpr int Capacity = 128;
+			TArray<float> Values;
+			int Next = 0;
+		};
+
+		FCriticalSection Lock;
+		FRate ReceivedRate;
+		FRate RenderedRate;
+		FSamples ConversionTimes;
+		FSamples UploadTimes;
+		FSamples Latencies;
+		int64 ReceivedCount = 0;
+		int64 RenderedCount = 0;
+		FIntPoint Size{0, 0};
+	};
+}
@@ -0,0 +1,421 @@
+// Copyright 2023 Dolby Laboratories
+
+#include "DolbyIOVideoTexture.h"
+
+#include "DolbyIOVideoRHI.h"
+#include "DolbyIOVideoShaders.h"
+#include "Utils/DolbyIOStats.h"
+#include "Utils/DolbyIOTrace.h"
+
+#include "Async/Async.h"
+#include "Engine/Texture2D.h"
+#include "Materials/MaterialInstance.h"
+#include "RenderGraphUtils.h"
+#include "RenderingThread.h"
+#include "RHI.h"
+#include "Runtime/Launch/Resources/Version.h"
+#include "TextureResource.h"
+
+namespace DolbyIO
+{
+	FVideoTexture::FVideoTexture(TWeakPtr<FVideoAtlas, ESPMode::ThreadSafe> Atlas) : Atlas(MoveTemp(Atlas)) {}
+
+	FVideoTexture::~FVideoTexture()
+	{
+		DLB_DEC_MEMORY_STAT_BY(VideoBufferMemory, BufferMemory);
+		DLB_DEC_MEMORY_STAT_BY(VideoTextureMemory, TextureMemory);
+
+		// The last reference may be released by a render command
+		auto Release = [Tex = Texture.load(), Atlas = Atlas, Slot = MoveTemp(AtlasSlot)]() mutable
+		{
+			if (Tex)
+			{
+				Tex->RemoveFromRoot();
+			}
+			if (const TSharedPtr<FVideoAtlas, ESPMode::ThreadSafe> PinnedAtlas = Atlas.Pin())
+			{
+				PinnedAtlas->Release(Slot);
+			}
+		};
+		if (IsInGameThread())
+		{
+			Release();
+		}
+		else
+		{
+			AsyncTask(ENamedThreads::GameThread, MoveTemp(Release));
+		}
+	}
+
+	void FVideoTexture::OnDisplayChanged(FOnDisplayChanged OnDisplayChanged)
+	{
+		OnDisplayChangedCb = MoveTemp(OnDisplayChanged);
+	}
+
+	UTexture2D* FVideoTexture::GetTexture()
+	{
+		if (UTexture2D* Tex = AtlasTexture)
+		{
+			return Tex;
+		}
+		return Texture;
+	}
+
+	FLinearColor FVideoTexture::GetUVScaleOffset() const
+	{
+		return UVScaleOffset;
+	}
+
+	bool FVideoTexture::Resize(int InWidth, int InHeight, EBufferFormat InFormat)
+	{
+		FFrame& Frame = Frames.GetWriteSlot();
+		if (Frame.Width != InWidth || Frame.Height != InHeight || Frame.Format != InFormat)
+		{
+			Frame.Width = InWidth;
+			Frame.Height = InHeight;
+			Frame.Format = InFormat;
+			const int64 AllocatedSize = Frame.Buffer.GetAllocatedSize();
+			Frame.Buffer.SetNumUninitialized(GetBufferSize(InWidth, InHeight, InFormat));
+			const int64 AllocatedSizeDelta = Frame.Buffer.GetAllocatedSize() - AllocatedSize;
+			BufferMemory += AllocatedSizeDelta;
+			DLB_INC_MEMORY_STAT_BY(VideoBufferMemory, AllocatedSizeDelta);
+		}
+
+		FrameFormat = InFormat;
+		if (FrameWidth == InWidth && FrameHeight == InHeight)
+		{
+			return false;
+		}
+
+		FrameWidth = InWidth;
+		FrameHeight = InHeight;
+		return true;
+	}
+
+	uint8* FVideoTexture::GetBuffer()
+	{
+		return Frames.GetWriteSlot().Buffer.GetData();
+	}
+
+	void FVideoTexture::PublishFrame(double ArrivalTime)
+	{
+		Frames.GetWriteSlot().ArrivalTime = ArrivalTime;
+		PublishedSize = FIntPoint{FrameWidth, FrameHeight};
+		PublishedFormat = FrameFormat;
+		if (Frames.Publish())
+		{
+			++SkippedFrameCount;
+		}
+	}
+
+	uint64 FVideoTexture::GetSkippedFrameCount() const
+	{
+		return SkippedFrameCount;
+	}
+
+	FVideoStats& FVideoTexture::GetStats()
+	{
+		return Stats;
+	}
+
+	FIntPoint FVideoTexture::GetChromaSize(int Width, int Height)
+	{
+		return {(Width + 1) / 2, (Height + 1) / 2};
+	}
+
+	int FVideoTexture::GetBufferSize(int Width, int Height, EBufferFormat Format)
+	{
+		if (Format == EBufferFormat::BGRA)
+		{
+			return Width * Height * Stride;
+		}
+		// I420 holds the U and V planes separately, NV12 holds them interleaved, but the size is the same
+		const FIntPoint ChromaSize = GetChromaSize(Width, Height);
+		return Width * Height + 2 * ChromaSize.X * ChromaSize.Y;
+	}
+
+	namespace
+	{
+#if ENGINE_MAJOR_VERSION == 5
+#define PLATFORM_DATA GetPlatformData()
+#else
+#define PLATFORM_DATA PlatformData
+#endif
+
+		class FLockedTexture
+		{
+		public:
+			FLockedTexture(UTexture2D& Tex)
+			    : Tex(Tex), PlatformData(*Tex.PLATFORM_DATA), Mip(PlatformData.Mips[0]),
+			      Buffer(Mip.BulkData.Lock(LOCK_READ_WRITE))
+			{
+			}
+
+			~FLockedTexture()
+			{
+				Mip.BulkData.Unlock();
+				Tex.UpdateResource();
+				FlushRenderingCommands();
+			}
+
+			void Clear()
+			{
+				FMemory::Memzero(Buffer, Mip.BulkData.GetBulkDataSize());
+			}
+
+		private:
+			UTexture2D& Tex;
+			FTexturePlatformData& PlatformData;
+			FTexture2DMipMap& Mip;
+			void* Buffer;
+		};
+
+		// The frames are rendered to a separate RHI texture, so the resource is not recreated, but the bulk data must
+		// match the description in case anything else recreates the resource from it
+		void SetTextureSize(UTexture2D& Tex, int Width, int Height)
+		{
+			FTexturePlatformData& PlatformData = *Tex.PLATFORM_DATA;
+			FTexture2DMipMap& Mip = PlatformData.Mips[0];
+			Mip.SizeX = PlatformData.SizeX = Width;
+			Mip.SizeY = PlatformData.SizeY = Height;
+			Mip.BulkData.Lock(LOCK_READ_WRITE);
+			Mip.BulkData.Realloc(static_cast<int64>(Width) * Height * FVideoTexture::Stride);
+			Mip.BulkData.Unlock();
+		}
+	}
+
+	void FVideoTexture::CreateTexture()
+	{
+		const FIntPoint Size = PublishedSize;
+		UTexture2D* Tex = UTexture2D::CreateTransient(FMath::Max(Size.X, 1), FMath::Max(Size.Y, 1));
+		Tex->AddToRoot();
+		Tex->UpdateResource();
+		Texture = Tex;
+		DisplayedTexture = Tex;
+	}
+
+	bool FVideoTexture::PrepareRender()
+	{
+		UTexture2D* Tex = Texture;
+		if (!Tex)
+		{
+			return false;
+		}
+
+		const FIntPoint Size = PublishedSize;
+		if (Tex->GetSizeX() != Size.X || Tex->GetSizeY() != Size.Y)
+		{
+			SetTextureSize(*Tex, Size.X, Size.Y);
+		}
+		if (bIsFrameTextureSwapped.exchange(false))
+		{
+			RecacheMaterialInstanceUniformExpressions(Tex, false);
+		}
+		UpdateAtlasSlot(Size);
+		return true;
+	}
+
+	void FVideoTexture::UpdateAtlasSlot(FIntPoint Size)
+	{
+		const TSharedPtr<FVideoAtlas, ESPMode::ThreadSafe> PinnedAtlas = Atlas.Pin();
+		if (!PinnedAtlas)
+		{
+			// The slot's page was released along with the atlas
+			AtlasSlot = {};
+		}
+		else
+		{
+			const bool bUseAtlas = PublishedFormat == EBufferFormat::BGRA && PinnedAtlas->CanHold(Size);
+			if (AtlasSlot.Page && (!bUseAtlas || !PinnedAtlas->IsCurrent(AtlasSlot)))
+			{
+				PinnedAtlas->Release(AtlasSlot);
+			}
+			if (bUseAtlas && !AtlasSlot.Page)
+			{
+				AtlasSlot = PinnedAtlas->Allocate();
+			}
+			if (AtlasSlot.Page)
+			{
+				AtlasSlot.Page->PrepareRender();
+			}
+		}
+
+		AtlasTexture = AtlasSlot.Page ? AtlasSlot.Page->GetTexture() : nullptr;
+		const FLinearColor NewUVScaleOffset =
+		    AtlasSlot.Page ? FVideoAtlas::GetUVScaleOffset(AtlasSlot, Size) : FLinearColor{1.0f, 1.0f, 0.0f, 0.0f};
+		if (DisplayedTexture != GetTexture() || UVScaleOffset != NewUVScaleOffset)
+		{
+			DisplayedTexture = GetTexture();
+			UVScaleOffset = NewUVScaleOffset;
+			OnDisplayChangedCb();
+		}
+	}
+
+	const FVideoAtlasSlot& FVideoTexture::GetAtlasSlot() const
+	{
+		return AtlasSlot;
+	}
+
+	int64 FVideoTexture::RenderRHI(FRHICommandListImmediate& RHICmdList, const FVideoAtlasSlot& Slot)
+	{
+		// Nothing to do if a previous upload already took the newest frame
+		const FFrame* Frame = Frames.Acquire();
+		if (!Frame)
+		{
+			return 0;
+		}
+
+		DLB_TRACE_SCOPE(RenderFrame);
+		SCOPE_CYCLE_COUNTER(STAT_DolbyIO_UploadFrame);
+		const double Start = FPlatformTime::Seconds();
+		if (Frame->Format == EBufferFormat::BGRA)
+		{
+			// The slot may be a frame behind when the resolution changes, in which case the frame is rendered
+			// separately until the game thread moves it out of the atlas
+			if (Slot.Page && Frame->Width <= Slot.Page->GetCellSize().X && Frame->Height <= Slot.Page->GetCellSize().Y)
+			{
+				UploadToTextureRHI(Slot.Page->GetTextureRHI(), Frame->Buffer.GetData(), Frame->Width, Frame->Height,
+				                   Frame->Width * Stride, Slot.Offset);
+			}
+			else
+			{
+				UpdateTextureRHI(*Frame);
+			}
+		}
+		else
+		{
+			ConvertOnGpu(RHICmdList, *Frame);
+		}
+		UpdateTextureMemoryStat();
+		Stats.RecordUploaded(FPlatformTime::Seconds() - Start, Frame->ArrivalTime);
+		return GetBufferSize(Frame->Width, Frame->Height, Frame->Format);
+	}
+
+	void FVideoTexture::UpdateTextureRHI(const FFrame& Frame)
+	{
+		FrameTextureUAV.SafeRelease();
+		for (FTexture2DRHIRef& Plane : Planes)
+		{
+			Plane.SafeRelease();
+		}
+
+		EnsureTextureRHI(FrameTexture, TEXT("DolbyIOVideoFrame"), Frame.Width, Frame.Height, PF_B8G8R8A8,
+		                 TexCreate_ShaderResource | TexCreate_SRGB);
+		UploadToTextureRHI(FrameTexture, Frame.Buffer.GetData(), Frame.Width, Frame.Height, Frame.Width * Stride);
+		SwapInFrameTexture();
+	}
+
+	void FVideoTexture::ConvertOnGpu(FRHICommandListImmediate& RHICmdList, const FFrame& Frame)
+	{
+		const int Width = Frame.Width;
+		const int Height = Frame.Height;
+		const FIntPoint ChromaSize = GetChromaSize(Width, Height);
+		const bool bIsNV12 = Frame.Format == EBufferFormat::NV12;
+
+		// Same size as the CPU path's texture, the RHI gives the UAV the format's linear variant
+		if (EnsureTextureRHI(FrameTexture, TEXT("DolbyIOVideoFrame"), Width, Height, PF_R8G8B8A8,
+		                     TexCreate_ShaderResource | TexCreate_UAV | TexCreate_SRGB))
+		{
+			FrameTextureUAV = RHICreateUnorderedAccessView(FrameTexture, 0);
+		}
+
+		const uint8* Data = Frame.Buffer.GetData();
+		EnsureTextureRHI(Planes[0], TEXT("DolbyIOVideoPlaneY"), Width, Height, PF_G8);
+		UploadToTextureRHI(Planes[0], Data, Width, Height, Width);
+		Data += Width * Height;
+		if (bIsNV12)
+		{
+			EnsureTextureRHI(Planes[1], TEXT("DolbyIOVideoPlaneUV"), ChromaSize.X, ChromaSize.Y, PF_R8G8);
+			UploadToTextureRHI(Planes[1], Data, ChromaSize.X, ChromaSize.Y, ChromaSize.X * 2);
+			Planes[2].SafeRelease();
+		}
+		else
+		{
+			EnsureTextureRHI(Planes[1], TEXT("DolbyIOVideoPlaneU"), ChromaSize.X, ChromaSize.Y, PF_G8);
+			UploadToTextureRHI(Planes[1], Data, ChromaSize.X, ChromaSize.Y, ChromaSize.X);
+			Data += ChromaSize.X * ChromaSize.Y;
+			EnsureTextureRHI(Planes[2], TEXT("DolbyIOVideoPlaneV"), ChromaSize.X, ChromaSize.Y, PF_G8);
+			UploadToTextureRHI(Planes[2], Data, ChromaSize.X, ChromaSize.Y, ChromaSize.X);
+		}
+
+		FYUVToRGBCS::FPermutationDomain Permutation;
+		Permutation.Set<FYUVToRGBCS::FNV12>(bIsNV12);
+		TShaderMapRef<FYUVToRGBCS> Shader(GetGlobalShaderMap(GMaxRHIFeatureLevel), Permutation);
+
+		FYUVToRGBCS::FParameters Parameters;
+		Parameters.PlaneY = Planes[0];
+		if (bIsNV12)
+		{
+			Parameters.PlaneUV = Planes[1];
+		}
+		else
+		{
+			Parameters.PlaneU = Planes[1];
+			Parameters.PlaneV = Planes[2];
+		}
+		Parameters.Output = FrameTextureUAV;
+		Parameters.OutputSize = {Width, Height};
+
+		RHICmdList.Transition(FRHITransitionInfo(FrameTextureUAV, ERHIAccess::Unknown, ERHIAccess::UAVCompute));
+		FComputeShaderUtils::Dispatch(
+		    RHICmdList, Shader, Parameters,
+		    FComputeShaderUtils::GetGroupCount(FIntPoint{Width, Height}, FYUVToRGBCS::ThreadGroupSize));
+		RHICmdList.Transition(FRHITransitionInfo(FrameTexture, ERHIAccess::UAVCompute, ERHIAccess::SRVMask));
+
+		SwapInFrameTexture();
+	}
+
+	void FVideoTexture::SwapInFrameTexture()
+	{
+		// The texture's own RHI texture is replaced rather than resized, which would require recreating the resource
+		// and flushing the rendering thread. This also covers the resource having been recreated in the meantime.
+		if (SwapInTextureRHI(*Texture.load(), FrameTexture))
+		{
+			bIsFrameTextureSwapped = true;
+		}
+	}
+
+	namespace
+	{
+		int64 GetTextureMemory(const FRHITexture2D* TextureRHI)
+		{
+			if (!TextureRHI)
+			{
+				return 0;
+			}
+			const FPixelFormatInfo& Info = GPixelFormats[TextureRHI->GetFormat()];
+			return static_cast<int64>(FMath::DivideAndRoundUp<uint32>(TextureRHI->GetSizeX(), Info.BlockSizeX)) *
+			       FMath::DivideAndRoundUp<uint32>(TextureRHI->GetSizeY(), Info.BlockSizeY) * Info.BlockBytes;
+		}
+	}
+
+	void FVideoTexture::UpdateTextureMemoryStat()
+	{
+		int64 Memory = GetTextureMemory(FrameTexture);
+		for (const FTexture2DRHIRef& Plane : Planes)
+		{
+			Memory += GetTextureMemory(Plane);
+		}
+		// The delta is negative when the textures shrink or are released
+		DLB_INC_MEMORY_STAT_BY(VideoTextureMemory, Memory - TextureMemory);
+		TextureMemory = Memory;
+	}
+
+	namespace
+	{
+		UTexture2D* CreateEmptyTexture()
+		{
+			UTexture2D* Ret = UTexture2D::CreateTransient(1, 1);
+			Ret->AddToRoot();
+			FLockedTexture Tex{*Ret};
+			Tex.Clear();
+			return Ret;
+		}
+	}
+
+	UTexture2D* FVideoTexture::GetEmptyTexture()
+	{
+		static UTexture2D* Ret = CreateEmptyTexture();
+		return Ret;
+	}
+}
@@ -0,0 +1,117 @@
+// Copyright 2023 Dolby Laboratories
+
+#pragma once
+
+#include "Utils/DolbyIOTripleBuffer.h"
+#include "Video/DolbyIOVideoAtlas.h"
+#include "Video/DolbyIOVideoStats.h"
+
+#include "Math/Color.h"
+#include "RHIResources.h"
+#include "Templates/Function.h"
+#include "Templates/SharedPointer.h"
+
+#include <atomic>
+
+class FRHICommandListImmediate;
+class UTexture2D;
+
+namespace DolbyIO
+{
+	class FVideoTexture final : public TSharedFromThis<FVideoTexture, ESPMode::ThreadSafe>
+	{
+	public:
+		/** BGRA buffers are uploaded as they are, the planes of I420 and NV12 buffers are uploaded separately and
+		 * converted to RGB on the GPU. */
+		enum class EBufferFormat : uint8
+		{
+			BGRA,
+			I420,
+			NV12,
+		};
+
+		/** Frames are packed into the atlas while it is alive and enabled. */
+		FVideoTexture(TWeakPtr<FVideoAtlas, ESPMode::ThreadSafe> Atlas);
+		~FVideoTexture();
+
+		using FOnDisplayChanged = TFunction<void(void)>;
+
+		// Must be called on the game thread, frames published before the texture exists are kept until it does
+		void CreateTexture();
+		void OnDisplayChanged(FOnDisplayChanged OnDisplayChanged);
+
+		/** Returns the texture displaying the frames, which is shared with other tracks if the frames are packed into
+		 * the video atlas. */
+		UTexture2D* GetTexture();
+		/** Returns the part of the texture holding the frames, packed as (ScaleU, ScaleV, OffsetU, OffsetV). */
+		FLinearColor GetUVScaleOffset() const;
+
+		// Called on the thread delivering frames: Resize prepares the buffer for the next frame, which is written
+		// through GetBuffer and handed over to the rendering thread by PublishFrame without ever blocking.
+		bool Resize(int Width, int Height, EBufferFormat Format = EBufferFormat::BGRA);
+		uint8* GetBuffer();
+		void PublishFrame(double ArrivalTime);
+
+		// Called by FVideoUploadScheduler, PrepareRender on the game thread and RenderRHI on the rendering thread
+		bool PrepareRender();
+		const FVideoAtlasSlot& GetAtlasSlot() const;
+		/** Returns the number of bytes uploaded. */
+		int64 RenderRHI(FRHICommandListImmediate& RHICmdList, const FVideoAtlasSlot& AtlasSlot);
+
+		uint64 GetSkippedFrameCount() const;
+		FVideoStats& GetStats();
+
+		static UTexture2D* GetEmptyTexture();
+		static FIntPoint GetChromaSize(int Width, int Height);
+		static int GetBufferSize(int Width, int Height, EBufferFormat Format);
+
+		static constexpr int Stride = 4;
+
+	private:
+		friend class FVideoUploadScheduler;
+
+		struct FFrame
+		{
+			TArray<uint8> Buffer;
+			int Width = 0;
+			int Height = 0;
+			EBufferFormat Format = EBufferFormat::BGRA;
+			double ArrivalTime = 0.0;
+		};
+
+		void UpdateTextureRHI(const FFrame& Frame);
+		void ConvertOnGpu(FRHICommandListImmediate& RHICmdList, const FFrame& Frame);
+		void SwapInFrameTexture();
+		void UpdateTextureMemoryStat();
+		void UpdateAtlasSlot(FIntPoint Size);
+
+		std::atomic<UTexture2D*> Texture{nullptr};
+		std::atomic<UTexture2D*> AtlasTexture{nullptr};
+		TTripleBuffer<FFrame> Frames;
+		std::atomic<FIntPoint> PublishedSize{FIntPoint{0, 0}};
+		std::atomic<EBufferFormat> PublishedFormat{EBufferFormat::BGRA};
+		std::atomic<uint64> SkippedFrameCount{0};
+		FVideoStats Stats;
+		std::atomic<bool> bIsScheduled{false};
+		std::atomic<bool> bIsFrameTextureSwapped{false};
+
+		// Only accessed on the game thread
+		const TWeakPtr<FVideoAtlas, ESPMode::ThreadSafe> Atlas;
+		FVideoAtlasSlot AtlasSlot;
+		UTexture2D* DisplayedTexture = nullptr;
+		FLinearColor UVScaleOffset{1.0f, 1.0f, 0.0f, 0.0f};
+		FOnDisplayChanged OnDisplayChangedCb = [] {};
+
+		// Only accessed on the thread delivering frames
+		int FrameWidth = 0;
+		int FrameHeight = 0;
+		EBufferFormat FrameFormat = EBufferFormat::BGRA;
+		int64 BufferMemory = 0;
+
+		// Only accessed on the rendering thread
+		FTexture2DRHIRef FrameTexture;
+		FUnorderedAccessViewRHIRef FrameTextureUAV;
+		FTexture2DRHIRef Planes[3];
+		int64 TextureMemory = 0;
+	};
+}
@@ -0,0 +1,96 @@
+// Copyright 2023 Dolby Laboratories
+
+#include "DolbyIOVideoUploadScheduler.h"
+
+#include "DolbyIOVideoTexture.h"
+#include "Utils/DolbyIOTrace.h"
+
+#include "Misc/CoreDelegates.h"
+#include "RenderingThread.h"
+
+namespace DolbyIO
+{
+	namespace
+	{
+		using FTextures = TArray<TSharedRef<FVideoTexture, ESPMode::ThreadSafe>>;
+
+		struct FRenderRequest
+		{
+			TSharedRef<FVideoTexture, ESPMode::ThreadSafe> Texture;
+			// Copied because the game thread may move the texture to another slot in the meantime
+			FVideoAtlasSlot AtlasSlot;
+		};
+
+		FTextures ScheduledTextures;
+		FCriticalSection ScheduledTexturesLock;
+		FDelegateHandle OnEndFrameHandle;
+		std::atomic<int64> FramesInFlight{0};
+	}
+
+	void FVideoUploadScheduler::Startup()
+	{
+		OnEndFrameHandle = FCoreDelegates::OnEndFrame.AddStatic(&FVideoUploadScheduler::OnEndFrame);
+	}
+
+	void FVideoUploadScheduler::Shutdown()
+	{
+		FCoreDelegates::OnEndFrame.Remove(OnEndFrameHandle);
+		FScopeLock Lock{&ScheduledTexturesLock};
+		ScheduledTextures.Empty();
+	}
+
+	void FVideoUploadScheduler::Schedule(const TSharedRef<FVideoTexture, ESPMode::ThreadSafe>& Texture)
+	{
+		// A texture is scheduled at most once per engine frame, the upload takes whichever frame is newest by then
+		if (!Texture->bIsScheduled.exchange(true))
+		{
+			FScopeLock Lock{&ScheduledTexturesLock};
+			ScheduledTextures.Add(Texture);
+		}
+	}
+
+	void FVideoUploadScheduler::OnEndFrame()
+	{
+		DLB_TRACE_SCOPE(ScheduleUploads);
+
+		FTextures Textures;
+		{
+			FScopeLock Lock{&ScheduledTexturesLock};
+			if (!ScheduledTextures.Num())
+			{
+				return;
+			}
+			Swap(Textures, ScheduledTextures);
+		}
+
+		TArray<FRenderRequest> Requests;
+		Requests.Reserve(Textures.Num());
+		for (const TSharedRef<FVideoTexture, ESPMode::ThreadSafe>& Texture : Textures)
+		{
+			Texture->bIsScheduled = false;
+			if (Texture->PrepareRender())
+			{
+				Requests.Add(FRenderRequest{Texture, Texture->GetAtlasSlot()});
+			}
+		}
+		if (!Requests.Num())
+		{
+			return;
+		}
+
+		TRACE_COUNTER_SET(DolbyIOFramesInFlight, FramesInFlight += Requests.Num());
+		ENQUEUE_RENDER_COMMAND(DolbyIOUpdateTextures)
+		(
+		    [Requests = MoveTemp(Requests)](FRHICommandListImmediate& RHICmdList)
+		    {
+			    DLB_TRACE_SCOPE(UpdateTextures);
+			    int64 BytesUploaded = 0;
+			    for (const FRenderRequest& Request : Requests)
+			    {
+				    BytesUploaded += Request.Texture->RenderRHI(RHICmdList, Request.AtlasSlot);
+			    }
+			    TRACE_COUNTER_SET(DolbyIOBytesUploaded, BytesUploaded);
+			    TRACE_COUNTER_SET(DolbyIOFramesInFlight, FramesInFlight -= Requests.Num());
+		    });
+	}
+}
@@ -0,0 +1,24 @@
+// Copyright 2023 Dolby Laboratories
+
+#pragma once
+
+#include "Templates/SharedPointer.h"
+
+namespace DolbyIO
+{
+	class FVideoTexture;
+
+	/** Coalesces texture uploads: textures which received frames are collected from any thread and rendered once at
+	 * the end of each engine frame, all in a single render command. */
+	class FVideoUploadScheduler final
+	{
+	public:
+		static void Startup();
+		static void Shutdown();
+
+		static void Schedule(const TSharedRef<FVideoTexture, ESPMode::ThreadSafe>& Texture);
+
+	private:
+		static void OnEndFrame();
+	};
+}
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Components/ActorComponent.h"
+#include "Misc/Optional.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 
 #include "DolbyIOCppSdkFwd.h"
@@ -149,18 +150,34 @@ const FString&, ErrorMsg);
 
 namespace DolbyIO
 {
+	class FAudioCulling;
 	class FDevices;
 	class FErrorHandler;
+	class FEventQueue;
+	class FFakeConference;
+	class FSpatialSources;
+	class FStressTest;
+	class FVideoAtlas;
 	class FVideoFrameHandler;
 	class FVideoSink;
 }
 
+class UDolbyIOSpatialListenerComponent;
+class UDolbyIOSpatialSourceComponent;
+
 UCLASS(DisplayName = "Dolby.io Subsystem")
 class DOLBYIO_API UDolbyIOSubsystem : public UGameInstanceSubsystem
 {
 	GENERATED_BODY()
 
+	friend class DolbyIO::FAudioCulling;
 	friend class DolbyIO::FErrorHandler;
+	friend class DolbyIO::FEventQueue;
+	friend class DolbyIO::FFakeConference;
+	friend class DolbyIO::FSpatialSources;
+	friend class DolbyIO::FStressTest;
+	friend class UDolbyIOSpatialListenerComponent;
+	friend class UDolbyIOSpatialSourceComponent;
 
 public:
 	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms")
@@ -255,6 +272,30 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms")
 	class UTexture2D* GetTexture(const FString& VideoTrackID);
 
+	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms")
+	void SetVideoConversionMode(EDolbyIOVideoConversionMode ConversionMode);
+
+	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms")
+	void SetParallelVideoConversionEnabled(bool bEnabled);
+
+	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms")
+	void SetVideoAtlasEnabled(bool bEnabled, int CellWidth = 640, int CellHeight = 360);
+
+	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms")
+	void SetVideoVisibilityCullingEnabled(bool bEnabled);
+
+	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms")
+	void SetVideoTrackMaxResolution(const FString& VideoTrackID, int MaxWidth, int MaxHeight);
+
+	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms")
+	void SetVideoTrackMaxFrameRate(const FString& VideoTrackID, float MaxFrameRate);
+
+	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms")
+	int64 GetVideoTrackDroppedFrameCount(const FString& VideoTrackID);
+
+	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms")
+	TArray<FDolbyIOVideoTrackStats> GetVideoTrackStats();
+
 	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms")
 	void GetScreenshareSources();
 	UPROPERTY(BlueprintAssignable, Category = "Dolby.io Comms")
@@ -310,6 +351,12 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Dolby.io Comms")
 	FDolbyIOOnErrorDelegate OnSetRemotePlayerLocationError;
 
+	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms")
+	void SetRemotePlayerLocations(const TMap<FString, FVector>& Locations);
+
+	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms")
+	void SetRemoteAudioCullingDistance(float Distance, float Hysteresis = 500.0f);
+
 	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms")
 	void SetLogSettings(EDolbyIOLogLevel SdkLogLevel = EDolbyIOLogLevel::Info,
 	                    EDolbyIOLogLevel MediaLogLevel = EDolbyIOLogLevel::Info,
@@ -435,15 +482,29 @@ private:
 	void BroadcastRemoteParticipantConnectedIfNecessary(const FDolbyIOParticipantInfo& ParticipantInfo);
 	void BroadcastRemoteParticipantDisconnectedIfNecessary(const FDolbyIOParticipantInfo& ParticipantInfo);
 
+	void AddRemoteVideoTrack(const dolbyio::comms::video_track& Track, bool bIsFromSdk);
 	void BroadcastVideoTrackAdded(const FDolbyIOVideoTrack& VideoTrack);
 	void BroadcastVideoTrackEnabled(const FDolbyIOVideoTrack& VideoTrack);
 	void ProcessBufferedVideoTracks(const FString& ParticipantID);
+	void ProcessVideoTrackTextureCreated(const FDolbyIOVideoTrack& VideoTrack);
 	void WarnIfVideoTrackSuspicious(const FString& VideoTrackID);
 
+	void UpdateVideoSinksVisibility();
+
 	void SetLocationUsingFirstPlayer();
 	void SetLocalPlayerLocationImpl(const FVector& Location);
 	void SetRotationUsingFirstPlayer();
 	void SetLocalPlayerRotationImpl(const FRotator& Rotation);
+	bool SetAutomaticLocation(const FVector& Location, bool bForce = false);
+	bool SetAutomaticRotation(const FRotator& Rotation, bool bForce = false);
+	void UpdateTimerInterval(FTimerHandle& Handle, void (UDolbyIOSubsystem::*Callback)(), float DefaultInterval,
+	                         bool bIsIdle);
+
+	void AddListenerComponent(UDolbyIOSpatialListenerComponent& Listener);
+	void RemoveListenerComponent(UDolbyIOSpatialListenerComponent& Listener);
+	void SetListenerTransform(const UDolbyIOSpatialListenerComponent& Listener, const FTransform& Transform,
+	                          bool bForce = false);
+	void FlushRemotePlayerLocations();
 
 	void Handle(const dolbyio::comms::active_speaker_changed&);
 	void Handle(const dolbyio::comms::audio_device_changed&);
@@ -468,7 +529,7 @@ private:
 	EDolbyIOConnectionMode ConnectionMode;
 	EDolbyIOSpatialAudioStyle SpatialAudioStyle;
 	TMap<FString, TArray<FDolbyIOVideoTrack>> BufferedAddedVideoTracks;
-	TMap<FString, TArray<FDolbyIOVideoTrack>> BufferedEnabledVideoTracks;
+	TMap<FString, TArray<FDolbyIOVideoTrack>> BufferedEnabledVideoTracks; // guarded by VideoSinksLock
 
 	TMap<FString, FDolbyIOParticipantInfo> RemoteParticipants;
 	FCriticalSection RemoteParticipantsLock;
@@ -479,11 +540,19 @@ private:
 	std::shared_ptr<dolbyio::comms::plugin::video_processor> VideoProcessor;
 	std::shared_ptr<DolbyIO::FVideoFrameHandler> LocalCameraFrameHandler;
 	std::shared_ptr<DolbyIO::FVideoFrameHandler> LocalScreenshareFrameHandler;
+	TSharedPtr<DolbyIO::FEventQueue> EventQueue;
+	TSharedPtr<DolbyIO::FAudioCulling> AudioCulling;
 	TSharedPtr<DolbyIO::FDevices> Devices;
+	TSharedPtr<DolbyIO::FFakeConference> FakeConference;
+	TSharedPtr<DolbyIO::FSpatialSources> SpatialSources;
+	TSharedPtr<DolbyIO::FStressTest> StressTest;
+	TSharedPtr<DolbyIO::FVideoAtlas, ESPMode::ThreadSafe> VideoAtlas;
 	TSharedPtr<dolbyio::comms::sdk> Sdk;
 	TSharedPtr<dolbyio::comms::refresh_token> RefreshTokenCb;
 
 	float SpatialEnvironmentScale = 1.0f;
+	EDolbyIOVideoConversionMode VideoConversionMode = EDolbyIOVideoConversionMode::CPU;
+	bool bIsParallelVideoConversionEnabled = false;
 
 	bool bIsInputMuted = false;
 	bool bIsOutputMuted = false;
@@ -491,9 +560,23 @@ private:
 
 	FTimerHandle LocationTimerHandle;
 	FTimerHandle RotationTimerHandle;
+	FTimerHandle VisibilityTimerHandle;
+
+	// Last location and rotation of the first player which were set automatically
+	TOptional<FVector> LastAutomaticLocation;
+	TOptional<FRotator> LastAutomaticRotation;
+	// Active listener components, the last one is used and the first player is not followed while there are any
+	TArray<TWeakObjectPtr<UDolbyIOSpatialListenerComponent>> ListenerComponents;
+
+	// Remote player locations set during the frame or collected from spatial sources, sent to the SDK together at
+	// its end
+	TMap<FString, FVector> PendingRemotePlayerLocations;
+	FDelegateHandle FlushRemotePlayerLocationsHandle;
 
 	static constexpr auto LocalCameraTrackID = "local-camera";
 	static constexpr auto LocalScreenshareTrackID = "local-screenshare";
+	static constexpr float LocationTimerInterval = 0.1f;
+	static constexpr float RotationTimerInterval = 0.01f;
 };
 
 UCLASS(ClassGroup = "Dolby.io Comms",
@@ -969,6 +969,123 @@ public:
 		DLB_EXECUTE_RETURNING_SUBSYSTEM_METHOD(GetTexture, VideoTrackID);
 	}
 
+	/** Sets where video frames are converted to RGB. GPU conversion avoids the per-pixel conversion on the CPU and
+	 * uploads less data, and falls back to CPU conversion if the platform does not support compute shaders.
+	 *
+	 * @param ConversionMode - The conversion mode.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms",
+	          Meta = (WorldContext = "WorldContextObject", DisplayName = "Dolby.io Set Video Conversion Mode"))
+	static void SetVideoConversionMode(const UObject* WorldContextObject, EDolbyIOVideoConversionMode ConversionMode)
+	{
+		DLB_EXECUTE_SUBSYSTEM_METHOD(SetVideoConversionMode, ConversionMode);
+	}
+
+	/** Enables or disables converting video frames on worker threads. By default, frames are converted on the threads
+	 * delivering them, which limits how many tracks can be converted at the same time. When enabled, frames are
+	 * converted on the task graph so that many tracks are converted in parallel. Frames of a single track are still
+	 * converted one at a time and frames arriving faster than they are converted are skipped.
+	 *
+	 * @param bEnabled - Whether to convert frames on worker threads.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms",
+	          Meta = (WorldContext = "WorldContextObject",
+	                  DisplayName = "Dolby.io Set Parallel Video Conversion Enabled"))
+	static void SetParallelVideoConversionEnabled(const UObject* WorldContextObject, bool bEnabled)
+	{
+		DLB_EXECUTE_SUBSYSTEM_METHOD(SetParallelVideoConversionEnabled, bEnabled);
+	}
+
+	/** Enables or disables packing the frames of video tracks into a few large shared textures, which reduces the
+	 * number of textures and uploads when displaying many tracks at once. Frames converted on the CPU which fit in
+	 * a cell of the given size are packed, other frames keep using a separate texture.
+	 *
+	 * Materials bound using Dolby.io Bind Material receive the part of the texture holding the track's frames in a
+	 * vector parameter named "DolbyIO UV" as (ScaleU, ScaleV, OffsetU, OffsetV) and should sample the "DolbyIO
+	 * Frame" texture at UV * Scale + Offset. The parameter is (1, 1, 0, 0) for tracks which are not packed.
+	 *
+	 * @param bEnabled - Whether to pack frames into shared textures.
+	 * @param CellWidth - The maximum width of packed frames.
+	 * @param CellHeight - The maximum height of packed frames.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms",
+	          Meta = (WorldContext = "WorldContextObject", DisplayName = "Dolby.io Set Video Atlas Enabled"))
+	static void SetVideoAtlasEnabled(const UObject* WorldContextObject, bool bEnabled, int CellWidth = 640,
+	                                 int CellHeight = 360)
+	{
+		DLB_EXECUTE_SUBSYSTEM_METHOD(SetVideoAtlasEnabled, bEnabled, CellWidth, CellHeight);
+	}
+
+	/** Enables or disables suspending video tracks whose frames are not visible. While enabled, frames of a track are
+	 * not converted nor uploaded unless one of the materials bound to it using Dolby.io Bind Material was recently
+	 * rendered, and rendering resumes with the next frame once one is. Only materials created for a primitive
+	 * component or an actor can be tracked, tracks with other bound materials or no bound materials are never
+	 * suspended.
+	 *
+	 * @param bEnabled - Whether to suspend video tracks which are not visible.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms",
+	          Meta = (WorldContext = "WorldContextObject",
+	                  DisplayName = "Dolby.io Set Video Visibility Culling Enabled"))
+	static void SetVideoVisibilityCullingEnabled(const UObject* WorldContextObject, bool bEnabled)
+	{
+		DLB_EXECUTE_SUBSYSTEM_METHOD(SetVideoVisibilityCullingEnabled, bEnabled);
+	}
+
+	/** Limits the resolution at which frames of a video track are rendered. Larger frames are downscaled preserving
+	 * their aspect ratio before being converted and uploaded, which saves work for tracks displayed on small
+	 * surfaces.
+	 *
+	 * @param VideoTrackID - The ID of the video track.
+	 * @param MaxWidth - The maximum width of rendered frames or 0 for no limit.
+	 * @param MaxHeight - The maximum height of rendered frames or 0 for no limit.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms",
+	          Meta = (WorldContext = "WorldContextObject", DisplayName = "Dolby.io Set Video Track Max Resolution"))
+	static void SetVideoTrackMaxResolution(const UObject* WorldContextObject, const FString& VideoTrackID,
+	                                       int MaxWidth, int MaxHeight)
+	{
+		DLB_EXECUTE_SUBSYSTEM_METHOD(SetVideoTrackMaxResolution, VideoTrackID, MaxWidth, MaxHeight);
+	}
+
+	/** Limits the rate at which frames of a video track are rendered. Frames arriving faster are dropped before
+	 * being converted and uploaded, which saves work for tracks which do not need to be as smooth as others.
+	 *
+	 * @param VideoTrackID - The ID of the video track.
+	 * @param MaxFrameRate - The maximum number of frames rendered per second or 0 for no limit.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms",
+	          Meta = (WorldContext = "WorldContextObject", DisplayName = "Dolby.io Set Video Track Max Frame Rate"))
+	static void SetVideoTrackMaxFrameRate(const UObject* WorldContextObject, const FString& VideoTrackID,
+	                                      float MaxFrameRate)
+	{
+		DLB_EXECUTE_SUBSYSTEM_METHOD(SetVideoTrackMaxFrameRate, VideoTrackID, MaxFrameRate);
+	}
+
+	/** Gets the number of frames of a video track dropped because of its maximum frame rate.
+	 *
+	 * @param VideoTrackID - The ID of the video track.
+	 * @return The number of dropped frames or 0 if no such track exists.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms",
+	          Meta = (WorldContext = "WorldContextObject",
+	                  DisplayName = "Dolby.io Get Video Track Dropped Frame Count"))
+	static int64 GetVideoTrackDroppedFrameCount(const UObject* WorldContextObject, const FString& VideoTrackID)
+	{
+		DLB_EXECUTE_RETURNING_SUBSYSTEM_METHOD(GetVideoTrackDroppedFrameCount, VideoTrackID);
+	}
+
+	/** Gets the rendering statistics of all video tracks, including the local camera and screenshare tracks.
+	 *
+	 * @return The statistics of each video track.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms",
+	          Meta = (WorldContext = "WorldContextObject", DisplayName = "Dolby.io Get Video Track Stats"))
+	static TArray<FDolbyIOVideoTrackStats> GetVideoTrackStats(const UObject* WorldContextObject)
+	{
+		DLB_EXECUTE_RETURNING_SUBSYSTEM_METHOD(GetVideoTrackStats);
+	}
+
 	/** Changes the screen sharing parameters if already sharing screen.
 	 *
 	 * @param EncoderHint - Provides a hint to the plugin as to what type of content is being captured by the screen
@@ -992,6 +1109,9 @@ public:
 	 * Calling this function even once disables the default behavior, which is to automatically use the location of
 	 * the first player controller.
 	 *
+	 * To automatically use the location of another actor or camera, for example in split-screen or spectator mode, add
+	 * a Dolby.io Spatial Listener component to it instead.
+	 *
 	 * @param Location - The location of the listener.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms",
@@ -1006,6 +1126,9 @@ public:
 	 * Calling this function even once disables the default behavior, which is to automatically use the rotation of
 	 * the first player controller.
 	 *
+	 * To automatically use the rotation of another actor or camera, for example in split-screen or spectator mode, add
+	 * a Dolby.io Spatial Listener component to it instead.
+	 *
 	 * @param Rotation - The rotation of the listener.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms",
@@ -1021,6 +1144,11 @@ public:
 	 *
 	 * Calling this function with the local participant ID has no effect. Use Set Local Player Location instead.
 	 *
+	 * The location is sent at the end of the frame, together with the other remote participants' locations.
+	 *
+	 * To automatically use the location of the participant's avatar, add a Dolby.io Spatial Source component to it and
+	 * set its participant ID instead.
+	 *
 	 * @param ParticipantID - The ID of the remote participant.
 	 * @param Location - The location of the remote participant.
 	 */
@@ -1032,6 +1160,43 @@ public:
 		DLB_EXECUTE_SUBSYSTEM_METHOD(SetRemotePlayerLocation, ParticipantID, Location);
 	}
 
+	/** Updates the locations of the given remote participants for spatial audio purposes.
+	 *
+	 * This is only applicable when the spatial audio style of the conference is set to "Individual".
+	 *
+	 * The locations set during a frame, using this function or Set Remote Player Location, are sent together at the
+	 * end of the frame and only the last location set for each participant is used. The local participant ID is
+	 * ignored. Use Set Local Player Location instead.
+	 *
+	 * @param Locations - The locations of the remote participants, indexed by their IDs.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms",
+	          Meta = (WorldContext = "WorldContextObject", DisplayName = "Dolby.io Set Remote Player Locations"))
+	static void SetRemotePlayerLocations(const UObject* WorldContextObject, const TMap<FString, FVector>& Locations)
+	{
+		DLB_EXECUTE_SUBSYSTEM_METHOD(SetRemotePlayerLocations, Locations);
+	}
+
+	/** Stops receiving the audio of remote participants who are farther from the listener than the given distance and
+	 * starts it again once they come back closer than the distance minus the hysteresis.
+	 *
+	 * This is only applicable when the spatial audio style of the conference is set to "Individual" and only to
+	 * participants whose locations are set. Participants muted using Mute Participant stay muted regardless of their
+	 * distance and participants unmuted using Unmute Participant while they are too far are unmuted once they come
+	 * back within the distance.
+	 *
+	 * @param Distance - The distance beyond which the audio is stopped, 0 disables culling.
+	 * @param Hysteresis - How much closer participants must come before their audio is started again, at most half of
+	 * the distance.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms",
+	          Meta = (WorldContext = "WorldContextObject", DisplayName = "Dolby.io Set Remote Audio Culling Distance"))
+	static void SetRemoteAudioCullingDistance(const UObject* WorldContextObject, float Distance,
+	                                          float Hysteresis = 500.0f)
+	{
+		DLB_EXECUTE_SUBSYSTEM_METHOD(SetRemoteAudioCullingDistance, Distance, Hysteresis);
+	}
+
 	/** Sets what to log in the Dolby.io C++ SDK.
 	 *
 	 * This function should be called before the first call to Set Token if the user needs logs about the plugin's
@@ -23,6 +23,7 @@ namespace dolbyio::comms
 	struct remote_video_track_added;
 	struct remote_video_track_removed;
 	struct screen_share_error;
+	struct video_track;
 
 	namespace utils
 	{
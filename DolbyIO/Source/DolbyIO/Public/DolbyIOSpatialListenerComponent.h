@@ -0,0 +1,39 @@
+// Copyright 2023 Dolby Laboratories
+
+#pragma once
+
+#include "Components/SceneComponent.h"
+
+#include "DolbyIOSpatialListenerComponent.generated.h"
+
+/** Sets the location and rotation of the listener for spatial audio purposes whenever the component moves, replacing
+ * the default behavior of following the first player controller while the component is active. The component can be
+ * attached to any actor or camera, for example the camera of one of the split-screen players or of a spectator. If
+ * several listener components are active, the most recently activated one is used.
+ */
+UCLASS(ClassGroup = "Dolby.io Comms",
+       Meta = (BlueprintSpawnableComponent, DisplayName = "Dolby.io Spatial Listener",
+               ToolTip = "Component which sets the location and rotation of the spatial audio listener."))
+class DOLBYIO_API UDolbyIOSpatialListenerComponent : public USceneComponent
+{
+	GENERATED_BODY()
+
+public:
+	UDolbyIOSpatialListenerComponent();
+
+protected:
+	void BeginPlay() override;
+	void EndPlay(EEndPlayReason::Type EndPlayReason) override;
+	void Activate(bool bReset) override;
+	void Deactivate() override;
+	void OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport) override;
+
+private:
+	UFUNCTION()
+	void OnConnected(const FString& LocalParticipantID, const FString& ConferenceID);
+
+	void AddListener();
+	void RemoveListener();
+
+	bool bIsListener = false;
+};
@@ -0,0 +1,47 @@
+// Copyright 2023 Dolby Laboratories
+
+#pragma once
+
+#include "Components/SceneComponent.h"
+
+#include "DolbyIOSpatialSourceComponent.generated.h"
+
+/** Sets the location of a remote participant for spatial audio purposes to the location of the component, which is
+ * typically attached to the participant's avatar. The locations of all active sources which moved are sent together
+ * once per frame.
+ *
+ * This is only applicable when the spatial audio style of the conference is set to "Individual".
+ */
+UCLASS(ClassGroup = "Dolby.io Comms",
+       Meta = (BlueprintSpawnableComponent, DisplayName = "Dolby.io Spatial Source",
+               ToolTip = "Component which sets the location of a remote participant for spatial audio purposes."))
+class DOLBYIO_API UDolbyIOSpatialSourceComponent : public USceneComponent
+{
+	GENERATED_BODY()
+
+public:
+	UDolbyIOSpatialSourceComponent();
+
+	/** Sets the ID of the remote participant located at the component.
+	 *
+	 * @param InParticipantID - The ID of the remote participant.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Dolby.io Comms")
+	void SetParticipantID(const FString& InParticipantID);
+
+	/** The ID of the remote participant located at the component. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Dolby.io Comms")
+	FString ParticipantID;
+
+protected:
+	void BeginPlay() override;
+	void EndPlay(EEndPlayReason::Type EndPlayReason) override;
+	void Activate(bool bReset) override;
+	void Deactivate() override;
+
+private:
+	void AddSource();
+	void RemoveSource();
+
+	bool bIsSource = false;
+};
@@ -64,6 +64,17 @@ enum class EDolbyIOVideoCodec : uint8
 	None
 };
 
+/** Where video frames are converted to RGB. */
+UENUM(BlueprintType, DisplayName = "Dolby.io Video Conversion Mode")
+enum class EDolbyIOVideoConversionMode : uint8
+{
+	/** Frames are converted on a worker thread and uploaded as RGB. */
+	CPU,
+	/** Frame planes are uploaded as they are and converted by a compute shader. Falls back to CPU if compute shaders
+	 * are not supported. */
+	GPU
+};
+
 UENUM(BlueprintType, DisplayName = "Dolby.io Participant Status")
 enum class EDolbyIOParticipantStatus : uint8
 {
@@ -264,6 +275,61 @@ struct DOLBYIO_API FDolbyIOVideoTrack
 	bool bIsScreenshare{};
 };
 
+/** Statistics of rendering a video track. Times are in milliseconds. */
+USTRUCT(BlueprintType, DisplayName = "Dolby.io Video Track Stats")
+struct DOLBYIO_API FDolbyIOVideoTrackStats
+{
+	GENERATED_BODY()
+
+	/** The ID of the video track. */
+	UPROPERTY(BlueprintReadOnly, Category = "Dolby.io Comms")
+	FString TrackID;
+
+	/** The number of frames received per second. */
+	UPROPERTY(BlueprintReadOnly, Category = "Dolby.io Comms")
+	float ReceivedFrameRate{};
+
+	/** The number of frames uploaded to the GPU per second. */
+	UPROPERTY(BlueprintReadOnly, Category = "Dolby.io Comms")
+	float RenderedFrameRate{};
+
+	/** The number of received frames which were never uploaded to the GPU. */
+	UPROPERTY(BlueprintReadOnly, Category = "Dolby.io Comms")
+	int64 DroppedFrames{};
+
+	/** The width of the most recently received frame. */
+	UPROPERTY(BlueprintReadOnly, Category = "Dolby.io Comms")
+	int Width{};
+
+	/** The height of the most recently received frame. */
+	UPROPERTY(BlueprintReadOnly, Category = "Dolby.io Comms")
+	int Height{};
+
+	/** The average time of converting a frame. */
+	UPROPERTY(BlueprintReadOnly, Category = "Dolby.io Comms")
+	float AverageConversionTime{};
+
+	/** The 95th percentile of the time of converting a frame. */
+	UPROPERTY(BlueprintReadOnly, Category = "Dolby.io Comms")
+	float P95ConversionTime{};
+
+	/** The average time of uploading a frame on the rendering thread. */
+	UPROPERTY(BlueprintReadOnly, Category = "Dolby.io Comms")
+	float AverageUploadTime{};
+
+	/** The 95th percentile of the time of uploading a frame on the rendering thread. */
+	UPROPERTY(BlueprintReadOnly, Category = "Dolby.io Comms")
+	float P95UploadTime{};
+
+	/** The average time from receiving a frame to uploading it. */
+	UPROPERTY(BlueprintReadOnly, Category = "Dolby.io Comms")
+	float AverageLatency{};
+
+	/** The 95th percentile of the time from receiving a frame to uploading it. */
+	UPROPERTY(BlueprintReadOnly, Category = "Dolby.io Comms")
+	float P95Latency{};
+};
+
 /** The level of logs of the Dolby.io C++ SDK. */
 UENUM(BlueprintType, DisplayName = "Dolby.io Log Level")
 enum class EDolbyIOLogLevel : uint8
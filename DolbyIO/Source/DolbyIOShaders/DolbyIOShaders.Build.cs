@@ -0,0 +1,15 @@
+// Copyright 2023 Dolby Laboratories
+
+using UnrealBuildTool;
+
+public class DolbyIOShaders : ModuleRules
+{
+    public DolbyIOShaders(ReadOnlyTargetRules Target) : base(Target)
+    {
+        PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+
+        CppStandard = CppStandardVersion.Cpp17;
+
+        PublicDependencyModuleNames.AddRange(new string[] { "Core", "Projects", "RenderCore", "RHI" });
+    }
+}
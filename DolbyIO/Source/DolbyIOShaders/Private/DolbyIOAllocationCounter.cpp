@@ -0,0 +1,137 @@
+// Copyright 2023 Dolby Laboratories
+
+#include "DolbyIOAllocationCounter.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HAL/MemoryBase.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+
+#include <atomic>
+
+DEFINE_LOG_CATEGORY_STATIC(LogDolbyIOShaders, Log, All);
+
+namespace DolbyIO
+{
+	namespace
+	{
+		thread_local bool bIsCounting = false;
+		std::atomic<int64> Allocations{0};
+		bool bIsAvailable = false;
+
+		// Other threads only pay for the check
+		class FCountingMalloc final : public FMalloc
+		{
+		public:
+			explicit FCountingMalloc(FMalloc* InInner) : Inner(InInner) {}
+
+			void* Malloc(SIZE_T Count, uint32 Alignment) override
+			{
+				CountAllocation();
+				return Inner->Malloc(Count, Alignment);
+			}
+			void* Realloc(void* Ptr, SIZE_T NewSize, uint32 Alignment) override
+			{
+				if (NewSize)
+				{
+					CountAllocation();
+				}
+				return Inner->Realloc(Ptr, NewSize, Alignment);
+			}
+			void Free(void* Ptr) override
+			{
+				Inner->Free(Ptr);
+			}
+			SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override
+			{
+				return Inner->QuantizeSize(Count, Alignment);
+			}
+			bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override
+			{
+				return Inner->GetAllocationSize(Original, SizeOut);
+			}
+			void Trim(bool bTrimThreadCaches) override
+			{
+				Inner->Trim(bTrimThreadCaches);
+			}
+			void SetupTLSCachesOnCurrentThread() override
+			{
+				Inner->SetupTLSCachesOnCurrentThread();
+			}
+			void ClearAndDisableTLSCachesOnCurrentThread() override
+			{
+				Inner->ClearAndDisableTLSCachesOnCurrentThread();
+			}
+			bool IsInternallyThreadSafe() const override
+			{
+				return Inner->IsInternallyThreadSafe();
+			}
+			const TCHAR* GetDescriptiveName() override
+			{
+				return Inner->GetDescriptiveName();
+			}
+
+		private:
+			static void CountAllocation()
+			{
+				if (bIsCounting)
+				{
+					++Allocations;
+				}
+			}
+
+			FMalloc* const Inner;
+		};
+	}
+
+	void FAllocationCounter::Startup()
+	{
+		if (!FParse::Param(FCommandLine::Get(), TEXT("DolbyIOCountAllocations")))
+		{
+			return;
+		}
+
+		// Never uninstalled nor destroyed, memory allocated through it is freed by the allocator it wraps
+		GMalloc = new FCountingMalloc(GMalloc);
+
+		// Platforms which inline their allocator into FMemory do not go through GMalloc
+		{
+			FScope Scope;
+			FMemory::Free(FMemory::Malloc(16));
+		}
+		bIsAvailable = Allocations > 0;
+		Allocations = 0;
+		if (bIsAvailable)
+		{
+			UE_LOG(LogDolbyIOShaders, Log, TEXT("Counting allocations"));
+		}
+		else
+		{
+			UE_LOG(LogDolbyIOShaders, Warning,
+			       TEXT("Cannot count allocations, the allocator does not go through GMalloc"));
+		}
+	}
+
+	bool FAllocationCounter::IsAvailable()
+	{
+		return bIsAvailable;
+	}
+
+	int64 FAllocationCounter::Get()
+	{
+		return Allocations;
+	}
+
+	FAllocationCounter::FScope::FScope()
+	{
+		bIsCounting = true;
+	}
+
+	FAllocationCounter::FScope::~FScope()
+	{
+		bIsCounting = false;
+	}
+}
+
+#endif
@@ -0,0 +1,26 @@
+// Copyright 2023 Dolby Laboratories
+
+#include "DolbyIOAllocationCounter.h"
+
+#include "Interfaces/IPluginManager.h"
+#include "Misc/Paths.h"
+#include "Modules/ModuleManager.h"
+#include "ShaderCore.h"
+
+// Loaded at PostConfigInit, which global shaders require, so that the rest of the plugin can load at PreDefault
+class FDolbyIOShadersModule final : public IModuleInterface
+{
+public:
+	void StartupModule() override
+	{
+#if WITH_DEV_AUTOMATION_TESTS
+		// This is the plugin's only module loaded before the task graph starts its threads
+		DolbyIO::FAllocationCounter::Startup();
+#endif
+
+		const FString PluginDir = IPluginManager::Get().FindPlugin("DolbyIO")->GetBaseDir();
+		AddShaderSourceDirectoryMapping(TEXT("/Plugin/DolbyIO"), FPaths::Combine(PluginDir, TEXT("Shaders")));
+	}
+};
+
+IMPLEMENT_MODULE(FDolbyIOShadersModule, DolbyIOShaders)
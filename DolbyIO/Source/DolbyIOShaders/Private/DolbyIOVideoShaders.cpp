@@ -0,0 +1,28 @@
+// Copyright 2023 Dolby Laboratories
+
+#include "DolbyIOVideoShaders.h"
+
+#include "RHI.h"
+
+namespace DolbyIO
+{
+	bool FYUVToRGBCS::ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+
+	void FYUVToRGBCS::ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters,
+	                                               FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+		OutEnvironment.SetDefine(TEXT("THREADGROUP_SIZE"), ThreadGroupSize);
+	}
+
+	IMPLEMENT_GLOBAL_SHADER(FYUVToRGBCS, "/Plugin/DolbyIO/Private/DolbyIOYUVToRGB.usf", "MainCS", SF_Compute);
+
+	bool IsGpuConversionSupported()
+	{
+		return IsFeatureLevelSupported(GMaxRHIShaderPlatform, ERHIFeatureLevel::SM5) &&
+		       RHISupportsComputeShaders(GMaxRHIShaderPlatform);
+	}
+}
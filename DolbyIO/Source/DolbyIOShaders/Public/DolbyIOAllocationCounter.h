@@ -0,0 +1,32 @@
+// Copyright 2023 Dolby Laboratories
+
+#pragma once
+
+#include "CoreTypes.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace DolbyIO
+{
+	/** Counts the heap allocations made by threads while they are in an FAllocationCounter::FScope. Counting routes
+	 * all allocations through a proxy, which is only installed if the -DolbyIOCountAllocations switch is passed and
+	 * only while the DolbyIOShaders module starts up, before the task graph's threads are running. */
+	class DOLBYIOSHADERS_API FAllocationCounter final
+	{
+	public:
+		// Called once when the DolbyIOShaders module starts up
+		static void Startup();
+		/** Returns false if the switch is not passed or if the platform's allocator bypasses the proxy. */
+		static bool IsAvailable();
+		/** Returns the number of allocations counted so far. */
+		static int64 Get();
+
+		struct FScope
+		{
+			FScope();
+			~FScope();
+		};
+	};
+}
+
+#endif
@@ -0,0 +1,38 @@
+// Copyright 2023 Dolby Laboratories
+
+#pragma once
+
+#include "GlobalShader.h"
+#include "ShaderParameterStruct.h"
+
+namespace DolbyIO
+{
+	class DOLBYIOSHADERS_API FYUVToRGBCS final : public FGlobalShader
+	{
+	public:
+		DECLARE_GLOBAL_SHADER(FYUVToRGBCS);
+		SHADER_USE_PARAMETER_STRUCT(FYUVToRGBCS, FGlobalShader);
+
+		class FNV12 : SHADER_PERMUTATION_BOOL("NV12");
+		using FPermutationDomain = TShaderPermutationDomain<FNV12>;
+
+		// clang-format off
+		BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+			SHADER_PARAMETER_TEXTURE(Texture2D<float>, PlaneY)
+			SHADER_PARAMETER_TEXTURE(Texture2D<float>, PlaneU)
+			SHADER_PARAMETER_TEXTURE(Texture2D<float>, PlaneV)
+			SHADER_PARAMETER_TEXTURE(Texture2D<float2>, PlaneUV)
+			SHADER_PARAMETER_UAV(RWTexture2D<float4>, Output)
+			SHADER_PARAMETER(FIntPoint, OutputSize)
+		END_SHADER_PARAMETER_STRUCT()
+		// clang-format on
+
+		static constexpr int ThreadGroupSize = 8;
+
+		static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters);
+		static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters,
+		                                         FShaderCompilerEnvironment& OutEnvironment);
+	};
+
+	DOLBYIOSHADERS_API bool IsGpuConversionSupported();
+}